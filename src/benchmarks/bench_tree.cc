@@ -0,0 +1,629 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <set>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "../s21_containers.h"
+
+using bench_clock = std::chrono::steady_clock;
+
+static double elapsedMs(bench_clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(bench_clock::now() - start)
+      .count();
+}
+
+static std::vector<int> makeKeys(size_t n) {
+  std::vector<int> keys(n);
+  for (size_t i = 0; i < n; ++i) keys[i] = static_cast<int>(i);
+  std::shuffle(keys.begin(), keys.end(), std::mt19937(42));
+  return keys;
+}
+
+// BULK LOAD
+
+static void benchBulkLoad(size_t n) {
+  std::vector<int> keys = makeKeys(n);
+
+  auto start = bench_clock::now();
+  s21::map<int, int> m;
+  for (int key : keys) m.insert(key, key);
+  double map_ms = elapsedMs(start);
+
+  start = bench_clock::now();
+  s21::set<int> s;
+  for (int key : keys) s.insert(key);
+  double set_ms = elapsedMs(start);
+
+  std::printf(
+      "%-10zu map %9.2f ms (%6.1f ns/op)   set %9.2f ms (%6.1f ns/op)\n", n,
+      map_ms, map_ms * 1e6 / n, set_ms, set_ms * 1e6 / n);
+}
+
+static void benchSortedLoad(size_t n) {
+  std::vector<std::pair<const int, int>> items;
+  for (size_t i = 0; i < n; ++i)
+    items.emplace_back(static_cast<int>(i), static_cast<int>(i));
+
+  auto start = bench_clock::now();
+  s21::map<int, int> m;
+  for (auto &item : items) m.insert(item);
+  double insert_ms = elapsedMs(start);
+
+  start = bench_clock::now();
+  auto sorted = s21::map<int, int>::from_sorted(items.begin(), items.end());
+  double sorted_ms = elapsedMs(start);
+
+  std::printf("%-10zu insert %9.2f ms   from_sorted %9.2f ms   (%zu)\n", n,
+              insert_ms, sorted_ms, sorted.size());
+}
+
+// INSERT AND LOOKUP LATENCY
+
+static void benchLatency(size_t n) {
+  std::vector<int> keys = makeKeys(n);
+  std::vector<int> probes = makeKeys(n);
+
+  auto start = bench_clock::now();
+  s21::map<int, int> m;
+  for (int key : keys) m.insert(key, key);
+  double insert_ms = elapsedMs(start);
+
+  size_t hits = 0;
+  start = bench_clock::now();
+  for (int key : probes) hits += m.contains(key);
+  double lookup_ms = elapsedMs(start);
+
+  start = bench_clock::now();
+  std::map<int, int> std_m;
+  for (int key : keys) std_m.emplace(key, key);
+  double std_insert_ms = elapsedMs(start);
+
+  start = bench_clock::now();
+  for (int key : probes) hits += std_m.count(key);
+  double std_lookup_ms = elapsedMs(start);
+
+  std::printf(
+      "%-10zu s21::map insert %6.1f ns lookup %6.1f ns   "
+      "std::map insert %6.1f ns lookup %6.1f ns   (%zu hits)\n",
+      n, insert_ms * 1e6 / n, lookup_ms * 1e6 / n, std_insert_ms * 1e6 / n,
+      std_lookup_ms * 1e6 / n, hits);
+}
+
+// FULL SCAN
+
+static void benchScan(size_t n) {
+  std::vector<int> keys = makeKeys(n);
+  s21::map<int, int> m;
+  std::map<int, int> std_m;
+  for (int key : keys) {
+    m.insert(key, key);
+    std_m.emplace(key, key);
+  }
+
+  long long sum = 0;
+  auto start = bench_clock::now();
+  for (auto it = m.begin(); it != m.end(); ++it) sum += it->value_;
+  double scan_ms = elapsedMs(start);
+
+  start = bench_clock::now();
+  for (auto it = std_m.begin(); it != std_m.end(); ++it) sum += it->second;
+  double std_scan_ms = elapsedMs(start);
+
+  std::printf(
+      "%-10zu s21::map %6.2f ns/step   std::map %6.2f ns/step   (%lld)\n", n,
+      scan_ms * 1e6 / n, std_scan_ms * 1e6 / n, sum);
+}
+
+// COPY
+
+static void benchCopy(size_t n) {
+  using pool_map =
+      s21::map<int, int, std::less<int>,
+               s21::pool_allocator<std::pair<const int, int>>>;
+  std::vector<int> keys = makeKeys(n);
+  s21::map<int, int> m;
+  pool_map pm;
+  std::map<int, int> std_m;
+  for (int key : keys) {
+    m.insert(key, key);
+    pm.insert(key, key);
+    std_m.emplace(key, key);
+  }
+
+  auto start = bench_clock::now();
+  s21::map<int, int> m_copy(m);
+  double copy_ms = elapsedMs(start);
+
+  start = bench_clock::now();
+  pool_map pm_copy(pm);
+  double pool_copy_ms = elapsedMs(start);
+
+  start = bench_clock::now();
+  std::map<int, int> std_copy(std_m);
+  double std_copy_ms = elapsedMs(start);
+
+  std::printf(
+      "%-10zu s21::map %8.2f ms   pooled %8.2f ms   std::map %8.2f ms   "
+      "(%zu)\n",
+      n, copy_ms, pool_copy_ms, std_copy_ms,
+      m_copy.size() + pm_copy.size() + std_copy.size());
+}
+
+// ORDER STATISTICS
+
+static void benchRank(size_t n) {
+  std::vector<int> keys = makeKeys(n);
+  s21::ranked_map<int, int> m;
+  for (int key : keys) m.insert(key, key);
+
+  long long sum = 0;
+  auto start = bench_clock::now();
+  for (size_t p = 10; p < 100; p += 10) {
+    auto it = m.begin();
+    for (size_t k = n * p / 100; k; --k) ++it;
+    sum += it->key_;
+  }
+  double walk_ms = elapsedMs(start);
+
+  start = bench_clock::now();
+  for (size_t p = 10; p < 100; p += 10)
+    sum += m.nth_element(n * p / 100)->key_;
+  double select_ms = elapsedMs(start);
+
+  std::printf("%-10zu walk %9.3f ms   nth_element %9.3f ms   (%lld)\n", n,
+              walk_ms, select_ms, sum);
+}
+
+// RANGE ERASE
+
+static void benchEraseRange(size_t n) {
+  std::vector<std::pair<const int, int>> items;
+  for (size_t i = 0; i < n; ++i)
+    items.emplace_back(static_cast<int>(i), static_cast<int>(i));
+  auto m = s21::map<int, int>::from_sorted(items.begin(), items.end());
+  auto m2 = m;
+
+  // Expire the oldest tenth of the keys.
+  int cutoff = static_cast<int>(n / 10);
+  auto start = bench_clock::now();
+  for (int key = 0; key < cutoff; ++key) m.erase(m.find(key));
+  double single_ms = elapsedMs(start);
+
+  start = bench_clock::now();
+  m2.erase_range(0, cutoff);
+  double range_ms = elapsedMs(start);
+
+  std::printf("%-10zu one by one %8.3f ms   erase_range %8.3f ms   (%zu)\n",
+              n, single_ms, range_ms, m.size() + m2.size());
+}
+
+// FLAT VS TREE
+
+static void benchFlat(size_t n) {
+  std::vector<std::pair<const int, int>> items;
+  for (size_t i = 0; i < n; ++i)
+    items.emplace_back(static_cast<int>(i), static_cast<int>(i));
+  std::vector<int> probes = makeKeys(n);
+  auto m = s21::map<int, int>::from_sorted(items.begin(), items.end());
+  auto flat = s21::flat_map<int, int>::from_sorted(items.begin(), items.end());
+
+  size_t hits = 0;
+  auto start = bench_clock::now();
+  for (int key : probes) hits += m.contains(key);
+  double map_lookup_ms = elapsedMs(start);
+
+  start = bench_clock::now();
+  for (int key : probes) hits += flat.contains(key);
+  double flat_lookup_ms = elapsedMs(start);
+
+  long long sum = 0;
+  start = bench_clock::now();
+  for (auto it = m.begin(); it != m.end(); ++it) sum += it->value_;
+  double map_scan_ms = elapsedMs(start);
+
+  start = bench_clock::now();
+  for (auto it = flat.begin(); it != flat.end(); ++it) sum += it->value_;
+  double flat_scan_ms = elapsedMs(start);
+
+  std::printf(
+      "%-10zu lookup map %6.1f ns flat %6.1f ns   "
+      "scan map %5.2f ns flat %5.2f ns   (%zu, %lld)\n",
+      n, map_lookup_ms * 1e6 / n, flat_lookup_ms * 1e6 / n,
+      map_scan_ms * 1e6 / n, flat_scan_ms * 1e6 / n, hits, sum);
+}
+
+// FROZEN INDEX
+
+static void benchFreeze(size_t n) {
+  std::vector<int> keys = makeKeys(n);
+  std::vector<int> probes = makeKeys(n);
+  s21::set<int> s;
+  for (int key : keys) s.insert(key);
+
+  auto start = bench_clock::now();
+  s21::frozen_set<int> frozen = s.freeze();
+  double freeze_ms = elapsedMs(start);
+
+  size_t hits = 0;
+  start = bench_clock::now();
+  for (int key : probes) hits += s.contains(key);
+  double set_ms = elapsedMs(start);
+
+  start = bench_clock::now();
+  for (int key : probes) hits += frozen.contains(key);
+  double frozen_ms = elapsedMs(start);
+
+  std::printf(
+      "%-10zu freeze %8.2f ms   lookup set %6.1f ns frozen %6.1f ns   "
+      "(%zu)\n",
+      n, freeze_ms, set_ms * 1e6 / n, frozen_ms * 1e6 / n, hits);
+}
+
+// B+TREE BACKEND
+
+template <typename Map>
+static void timeBackend(const char *name, const std::vector<int> &keys,
+                        const std::vector<int> &probes) {
+  auto start = bench_clock::now();
+  Map m;
+  for (int key : keys) m.insert(key, key);
+  double insert_ms = elapsedMs(start);
+
+  size_t hits = 0;
+  start = bench_clock::now();
+  for (int key : probes) hits += m.contains(key);
+  double lookup_ms = elapsedMs(start);
+
+  long long sum = 0;
+  start = bench_clock::now();
+  for (auto it = m.begin(); it != m.end(); ++it) sum += it->value_;
+  double scan_ms = elapsedMs(start);
+
+  size_t n = keys.size();
+  std::printf(
+      "%-10zu %-10s insert %6.1f ns   lookup %6.1f ns   scan %5.2f ns   "
+      "(%zu, %lld)\n",
+      n, name, insert_ms * 1e6 / n, lookup_ms * 1e6 / n, scan_ms * 1e6 / n,
+      hits, sum);
+}
+
+static void benchBTree(size_t n) {
+  std::vector<int> keys = makeKeys(n);
+  std::vector<int> probes = makeKeys(n);
+  timeBackend<s21::map<int, int>>("avl", keys, probes);
+  timeBackend<s21::btree_map<int, int>>("btree", keys, probes);
+}
+
+// SNAPSHOTS
+
+static void benchSnapshot(size_t n) {
+  std::vector<int> keys = makeKeys(n);
+  s21::map<int, int> m;
+  s21::persistent_map<int, int> pm;
+  for (int key : keys) {
+    m.insert(key, key);
+    pm.insert(key, key);
+  }
+
+  const int rounds = 10;
+  size_t total = 0;
+  auto start = bench_clock::now();
+  for (int i = 0; i < rounds; ++i) {
+    s21::map<int, int> copy(m);
+    m.insert_or_assign(keys[i], i);
+    total += copy.size();
+  }
+  double copy_us = elapsedMs(start) * 1e3 / rounds;
+
+  start = bench_clock::now();
+  for (int i = 0; i < rounds; ++i) {
+    s21::persistent_map<int, int> snap = pm.snapshot();
+    pm.insert_or_assign(keys[i], i);
+    total += snap.size();
+  }
+  double snap_us = elapsedMs(start) * 1e3 / rounds;
+
+  std::printf(
+      "%-10zu map copy + write %10.2f us   snapshot + write %6.2f us   "
+      "(%zu)\n",
+      n, copy_us, snap_us, total);
+}
+
+// CONCURRENT READS
+
+// Runs threads readers doing lookups for about 200 ms while one writer
+// updates a key every 100 us; returns million lookups per second. Each
+// reader thread gets its own lookup function from make_lookup.
+template <typename MakeLookup, typename Write>
+static double readThroughput(int threads, MakeLookup make_lookup,
+                             Write write) {
+  std::atomic<bool> done{false};
+  std::atomic<size_t> lookups{0};
+  std::vector<std::thread> readers;
+  auto start = bench_clock::now();
+  for (int t = 0; t < threads; ++t) {
+    readers.emplace_back([&, t] {
+      auto lookup = make_lookup();
+      std::mt19937 gen(t);
+      size_t local = 0;
+      while (!done.load(std::memory_order_relaxed)) {
+        for (int i = 0; i < 1000; ++i) local += lookup(gen());
+      }
+      lookups += local;
+    });
+  }
+  for (int i = 0; elapsedMs(start) < 200; ++i) {
+    write(i);
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+  }
+  done = true;
+  for (std::thread &t : readers) t.join();
+  return lookups.load() / elapsedMs(start) / 1e3;
+}
+
+static void benchConcurrent(int threads) {
+  using shared_map = s21::concurrent_map<int, int>;
+  const int n = 100000;
+  s21::map<int, int> locked;
+  std::mutex mutex;
+  shared_map shared;
+  for (int i = 0; i < n; ++i) {
+    locked.insert(i, i);
+    shared.insert(i, i);
+  }
+
+  double mutex_rate = readThroughput(
+      threads,
+      [&] {
+        return [&](unsigned key) {
+          std::lock_guard<std::mutex> lock(mutex);
+          return locked.contains(static_cast<int>(key % n)) ? 1 : 0;
+        };
+      },
+      [&](int i) {
+        std::lock_guard<std::mutex> lock(mutex);
+        locked.insert_or_assign(i % n, i);
+      });
+  double rcu_rate = readThroughput(
+      threads,
+      [&] {
+        auto reader = std::make_shared<shared_map::reader>(shared);
+        return [reader, n](unsigned key) {
+          return reader->contains(static_cast<int>(key % n)) ? 1 : 0;
+        };
+      },
+      [&](int i) { shared.insert_or_assign(i % n, i); });
+
+  std::printf("%-3d threads   mutex map %7.2f M/s   concurrent_map %7.2f M/s\n",
+              threads, mutex_rate, rcu_rate);
+}
+
+// SHARDED INGESTION
+
+// Splits keys across threads writers calling insert; returns ms.
+template <typename Insert>
+static double ingest(int threads, const std::vector<int> &keys,
+                     Insert insert) {
+  std::vector<std::thread> writers;
+  auto start = bench_clock::now();
+  for (int t = 0; t < threads; ++t) {
+    writers.emplace_back([&, t] {
+      for (size_t i = t; i < keys.size(); i += threads) insert(keys[i]);
+    });
+  }
+  for (std::thread &t : writers) t.join();
+  return elapsedMs(start);
+}
+
+static void benchSharded(int threads) {
+  std::vector<int> keys = makeKeys(1000000);
+  s21::map<int, int> locked;
+  std::mutex mutex;
+  double mutex_ms = ingest(threads, keys, [&](int key) {
+    std::lock_guard<std::mutex> lock(mutex);
+    locked.insert(key, key);
+  });
+  s21::sharded_map<int, int> sharded;
+  double sharded_ms =
+      ingest(threads, keys, [&](int key) { sharded.insert(key, key); });
+  std::printf("%-3d threads   mutex map %8.2f ms   sharded_map %8.2f ms\n",
+              threads, mutex_ms, sharded_ms);
+}
+
+// HASH TABLES
+
+template <typename Map, typename K>
+static void timeHash(const char *name, const std::vector<K> &keys,
+                     const std::vector<K> &probes) {
+  auto start = bench_clock::now();
+  Map m;
+  for (size_t i = 0; i < keys.size(); ++i) m[keys[i]] = static_cast<int>(i);
+  double insert_ms = elapsedMs(start);
+
+  size_t hits = 0;
+  start = bench_clock::now();
+  for (const K &key : probes) hits += m.find(key) != m.end();
+  double lookup_ms = elapsedMs(start);
+
+  size_t n = keys.size();
+  std::printf("%-10zu %-20s insert %6.1f ns   lookup %6.1f ns   (%zu)\n", n,
+              name, insert_ms * 1e6 / n, lookup_ms * 1e6 / n, hits);
+}
+
+static void benchHash(size_t n) {
+  std::vector<int> keys = makeKeys(n);
+  std::vector<int> probes = makeKeys(n);
+  timeHash<s21::map<int, int>>("int s21::map", keys, probes);
+  timeHash<std::unordered_map<int, int>>("int std::unordered", keys, probes);
+  timeHash<s21::unordered_map<int, int>>("int s21::unordered", keys, probes);
+
+  std::vector<std::string> skeys, sprobes;
+  for (int key : keys) skeys.push_back("user:" + std::to_string(key));
+  for (int key : probes) sprobes.push_back("user:" + std::to_string(key));
+  timeHash<s21::map<std::string, int>>("str s21::map", skeys, sprobes);
+  timeHash<std::unordered_map<std::string, int>>("str std::unordered", skeys,
+                                                 sprobes);
+  timeHash<s21::unordered_map<std::string, int>>("str s21::unordered", skeys,
+                                                 sprobes);
+}
+
+// POOL ALLOCATOR
+
+template <typename Map>
+static double insertEraseClear(const std::vector<int> &keys) {
+  auto start = bench_clock::now();
+  Map m;
+  for (int key : keys) m.insert(key, key);
+  for (size_t i = 0; i < keys.size(); i += 2) m.erase(m.find(keys[i]));
+  for (int key : keys) m.insert(key, key);
+  m.clear();
+  return elapsedMs(start);
+}
+
+static void benchPool(size_t n) {
+  using pool_map =
+      s21::map<int, int, std::less<int>,
+               s21::pool_allocator<std::pair<const int, int>>>;
+  std::vector<int> keys = makeKeys(n);
+  double heap_ms = insertEraseClear<s21::map<int, int>>(keys);
+  double pool_ms = insertEraseClear<pool_map>(keys);
+  std::printf("%-10zu std::allocator %9.2f ms   pool_allocator %9.2f ms\n", n,
+              heap_ms, pool_ms);
+}
+
+// MEMORY USAGE
+
+static size_t allocated_bytes = 0;
+
+template <typename T>
+struct countingAllocator : std::allocator<T> {
+  using value_type = T;
+  template <typename U>
+  struct rebind {
+    using other = countingAllocator<U>;
+  };
+
+  countingAllocator() = default;
+  template <typename U>
+  countingAllocator(const countingAllocator<U> &) {}
+
+  T *allocate(size_t n) {
+    allocated_bytes += n * sizeof(T);
+    return std::allocator<T>::allocate(n);
+  }
+  void deallocate(T *ptr, size_t n) {
+    allocated_bytes -= n * sizeof(T);
+    std::allocator<T>::deallocate(ptr, n);
+  }
+};
+
+template <typename Set>
+static double bytesPerElement(const std::vector<int> &keys) {
+  allocated_bytes = 0;
+  Set s;
+  for (int key : keys) s.insert(key);
+  return static_cast<double>(allocated_bytes) / keys.size();
+}
+
+template <typename T>
+static void benchMemory(const char *name, size_t n) {
+  std::vector<int> keys = makeKeys(n);
+  double s21_bytes = bytesPerElement<
+      s21::set<T, std::less<T>, countingAllocator<T>>>(keys);
+  double std_bytes =
+      bytesPerElement<std::set<T, std::less<T>, countingAllocator<T>>>(keys);
+  std::printf("%-10s s21::set %5.1f bytes/element   std::set %5.1f\n", name,
+              s21_bytes, std_bytes);
+}
+
+// DUPLICATE KEYS
+
+template <typename Set>
+static void timeMultiset(const char *name, const std::vector<int> &keys) {
+  allocated_bytes = 0;
+  auto start = bench_clock::now();
+  Set s;
+  for (int key : keys) s.insert(key);
+  double insert_ms = elapsedMs(start);
+  double bytes = static_cast<double>(allocated_bytes) / keys.size();
+
+  size_t copies = 0;
+  start = bench_clock::now();
+  for (int key : keys) copies += s.count(key);
+  double count_ms = elapsedMs(start);
+
+  size_t n = keys.size();
+  std::printf(
+      "%-10zu %-14s insert %6.1f ns   count %6.1f ns   %5.1f bytes/element   "
+      "(%zu)\n",
+      n, name, insert_ms * 1e6 / n, count_ms * 1e6 / n, bytes, copies);
+}
+
+// Every key appears ten times.
+static void benchDuplicates(size_t n) {
+  std::vector<int> keys = makeKeys(n);
+  for (int &key : keys) key /= 10;
+  timeMultiset<s21::multiset<int, std::less<int>, countingAllocator<int>>>(
+      "s21::multiset", keys);
+  timeMultiset<std::multiset<int, std::less<int>, countingAllocator<int>>>(
+      "std::multiset", keys);
+
+  auto start = bench_clock::now();
+  s21::map<int, s21::list<int>> lists;
+  for (size_t i = 0; i < n; ++i) lists[keys[i]].push_back(static_cast<int>(i));
+  double lists_ms = elapsedMs(start);
+  start = bench_clock::now();
+  s21::multimap<int, int> multi;
+  for (size_t i = 0; i < n; ++i) multi.insert(keys[i], static_cast<int>(i));
+  double multi_ms = elapsedMs(start);
+  std::printf("%-10zu map<K, list<V>> insert %6.1f ns   multimap %6.1f ns\n",
+              n, lists_ms * 1e6 / n, multi_ms * 1e6 / n);
+}
+
+int main() {
+  std::printf("bulk load, shuffled int keys\n");
+  for (size_t n = 10000; n <= 1000000; n *= 10) benchBulkLoad(n);
+  std::printf("\nbulk load, sorted pairs\n");
+  for (size_t n = 10000; n <= 1000000; n *= 10) benchSortedLoad(n);
+  std::printf("\ninsert / lookup latency per operation\n");
+  for (size_t n = 10000; n <= 1000000; n *= 10) benchLatency(n);
+  std::printf("\nfull in-order scan\n");
+  for (size_t n = 10000; n <= 1000000; n *= 10) benchScan(n);
+  std::printf("\ncopy construction\n");
+  for (size_t n = 10000; n <= 1000000; n *= 10) benchCopy(n);
+  std::printf("\ndecile lookups\n");
+  for (size_t n = 10000; n <= 1000000; n *= 10) benchRank(n);
+  std::printf("\nexpire oldest 10%% of keys\n");
+  for (size_t n = 10000; n <= 1000000; n *= 10) benchEraseRange(n);
+  std::printf("\nflat_map vs map, sorted int keys\n");
+  for (size_t n = 10000; n <= 1000000; n *= 10) benchFlat(n);
+  std::printf("\nfrozen_set vs set lookups\n");
+  for (size_t n = 10000; n <= 1000000; n *= 10) benchFreeze(n);
+  std::printf("\nAVL vs B+tree backend, shuffled int keys\n");
+  for (size_t n = 10000; n <= 1000000; n *= 10) benchBTree(n);
+  std::printf("\nsnapshot then one write\n");
+  for (size_t n = 10000; n <= 1000000; n *= 10) benchSnapshot(n);
+  std::printf("\nread throughput with one writer, 100000 keys\n");
+  for (int threads = 1; threads <= 8; threads *= 2) benchConcurrent(threads);
+  std::printf("\ningest 1000000 keys from several writers\n");
+  for (int threads = 1; threads <= 8; threads *= 2) benchSharded(threads);
+  std::printf("\nhash tables vs map, shuffled keys\n");
+  for (size_t n = 10000; n <= 1000000; n *= 10) benchHash(n);
+  std::printf("\ninsert, erase half, reinsert, clear\n");
+  for (size_t n = 10000; n <= 1000000; n *= 10) benchPool(n);
+  std::printf("\nduplicate keys, ten copies each\n");
+  for (size_t n = 10000; n <= 1000000; n *= 10) benchDuplicates(n);
+  std::printf("\nnode memory, 1000000 elements\n");
+  benchMemory<int>("int", 1000000);
+  benchMemory<long long>("long long", 1000000);
+  return 0;
+}
@@ -0,0 +1,641 @@
+#ifndef CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_BTREE_H_
+#define CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_BTREE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include "flat_search.h"
+
+namespace s21 {
+// Leaves of a key-only tree carry no value array.
+template <typename V, size_t N>
+struct btreeValues {
+  V values_[N];
+};
+template <size_t N>
+struct btreeValues<void, N> {};
+
+template <typename V>
+struct btreeValueBytes : std::integral_constant<size_t, sizeof(V)> {};
+template <>
+struct btreeValueBytes<void> : std::integral_constant<size_t, 0> {};
+
+// Number of entry_bytes slots that fit in node_bytes next to a header,
+// never fewer than four.
+constexpr size_t btreeSlots(size_t node_bytes, size_t entry_bytes,
+                            size_t header_bytes) {
+  return node_bytes > header_bytes + 4 * entry_bytes
+             ? (node_bytes - header_bytes) / entry_bytes
+             : 4;
+}
+
+// Element view with the same key_/value_ members as a map node.
+template <typename K, typename V>
+struct btreeReference {
+  const K &key_;
+  V &value_;
+
+  const btreeReference *operator->() const { return this; }
+};
+
+// B+tree with nodes sized to NodeBytes: every node keeps its keys in one
+// contiguous array, so a lookup touches about log_B(n) nodes of a few
+// cache lines each instead of log_2(n) scattered AVL nodes. All elements
+// live in the leaves, which are chained for in-order iteration. Node
+// arrays are built up front, so K and V must be default-constructible.
+template <typename K, typename V, typename Compare = std::less<K>,
+          size_t NodeBytes = 256>
+class BTree {
+ public:
+  using key_type = K;
+  using mapped_type = V;
+  using size_type = size_t;
+
+  static constexpr size_type kLeafSlots =
+      btreeSlots(NodeBytes, sizeof(K) + btreeValueBytes<V>::value,
+                 4 * sizeof(void *));
+  static constexpr size_type kInnerSlots =
+      btreeSlots(NodeBytes, sizeof(K) + sizeof(void *), 3 * sizeof(void *));
+
+ private:
+  struct node {
+    explicit node(bool leaf) : leaf_(leaf) {}
+
+    bool leaf_;
+    size_type count_ = 0;
+  };
+  // One spare slot lets an insert overflow a node before it is split.
+  struct leafNode : node, btreeValues<V, kLeafSlots + 1> {
+    leafNode() : node(true) {}
+
+    K keys_[kLeafSlots + 1];
+    leafNode *prev_ = nullptr;
+    leafNode *next_ = nullptr;
+  };
+  // Child i holds the keys in [keys_[i - 1], keys_[i]).
+  struct innerNode : node {
+    innerNode() : node(false) {}
+
+    K keys_[kInnerSlots + 1];
+    node *children_[kInnerSlots + 2];
+  };
+
+ public:
+  // M is the mapped type as seen through the iterator, or void to walk
+  // the keys only.
+  template <typename M>
+  class btreeIterator {
+   public:
+    /* ----- TYPES ----- */
+    using iterator_category = std::bidirectional_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::conditional_t<std::is_void<M>::value, const K &,
+                                         btreeReference<K, M>>;
+    using pointer = std::conditional_t<std::is_void<M>::value, const K *,
+                                       btreeReference<K, M>>;
+    using value_type = std::conditional_t<std::is_void<M>::value, K,
+                                          btreeReference<K, M>>;
+
+    btreeIterator() : tree_(nullptr), leaf_(nullptr), index_(0){};
+    btreeIterator(const BTree *tree, leafNode *leaf, size_type index)
+        : tree_(tree), leaf_(leaf), index_(index){};
+    template <typename N, typename = std::enable_if_t<
+                              std::is_same<const N, M>::value &&
+                              !std::is_same<N, M>::value>>
+    btreeIterator(const btreeIterator<N> &other)
+        : tree_(other.tree_), leaf_(other.leaf_), index_(other.index_) {}
+
+    btreeIterator &operator++() {
+      if (++index_ == leaf_->count_) {
+        leaf_ = leaf_->next_;
+        index_ = 0;
+      }
+      return *this;
+    }
+    btreeIterator &operator--() {
+      if (!leaf_) {
+        leaf_ = tree_->last_;
+        index_ = leaf_->count_ - 1;
+      } else if (index_) {
+        --index_;
+      } else {
+        leaf_ = leaf_->prev_;
+        index_ = leaf_->count_ - 1;
+      }
+      return *this;
+    }
+    btreeIterator operator++(int) {
+      btreeIterator ret_it(*this);
+      ++(*this);
+      return ret_it;
+    }
+    btreeIterator operator--(int) {
+      btreeIterator ret_it(*this);
+      --(*this);
+      return ret_it;
+    }
+
+    bool operator==(const btreeIterator &other) const {
+      return leaf_ == other.leaf_ && index_ == other.index_;
+    }
+    bool operator!=(const btreeIterator &other) const {
+      return !(*this == other);
+    }
+
+    reference operator*() const {
+      if constexpr (std::is_void<M>::value) {
+        return leaf_->keys_[index_];
+      } else {
+        return reference{leaf_->keys_[index_], leaf_->values_[index_]};
+      }
+    }
+    pointer operator->() const {
+      if constexpr (std::is_void<M>::value) {
+        return leaf_->keys_ + index_;
+      } else {
+        return **this;
+      }
+    }
+
+   private:
+    template <typename>
+    friend class btreeIterator;
+    friend class BTree;
+
+    const BTree *tree_;
+    leafNode *leaf_;
+    size_type index_;
+  };
+
+  // CONSTRUCTORS
+  BTree() = default;
+  explicit BTree(const Compare &comp) : comp_(comp) {}
+  BTree(const BTree &other) : comp_(other.comp_) {
+    if (!other.root_) return;
+    leafNode *prev = nullptr;
+    root_ = cloneNode(other.root_, prev);
+    last_ = prev;
+    while (prev->prev_) prev = prev->prev_;
+    first_ = prev;
+    count_ = other.count_;
+  }
+  BTree(BTree &&other) : comp_(other.comp_) { swap(other); }
+
+  // DESTRUCTOR
+  ~BTree() { clear(); }
+
+  // OVERLOAD OPERATORS
+  BTree &operator=(const BTree &other) {
+    if (this != &other) {
+      BTree copy(other);
+      swap(copy);
+    }
+    return *this;
+  }
+  BTree &operator=(BTree &&other) {
+    if (this != &other) {
+      clear();
+      swap(other);
+    }
+    return *this;
+  }
+
+  // MAIN FUNCTIONS
+  size_type size() const { return count_; }
+  Compare key_comp() const { return comp_; }
+  size_type height() const {
+    size_type levels = 0;
+    for (node *cur = root_; cur; ++levels) {
+      cur = cur->leaf_ ? nullptr : asInner(cur)->children_[0];
+    }
+    return levels;
+  }
+
+  template <typename M>
+  btreeIterator<M> begin() const {
+    return btreeIterator<M>(this, first_, 0);
+  }
+  template <typename M>
+  btreeIterator<M> end() const {
+    return btreeIterator<M>(this, nullptr, 0);
+  }
+
+  template <typename M>
+  btreeIterator<M> lowerBound(const K &key) const {
+    leafNode *leaf = findLeaf(key);
+    if (!leaf) return end<M>();
+    return toIterator<M>(leaf, lowerIndex(leaf->keys_, leaf->count_, key));
+  }
+  template <typename M>
+  btreeIterator<M> upperBound(const K &key) const {
+    leafNode *leaf = findLeaf(key);
+    if (!leaf) return end<M>();
+    return toIterator<M>(leaf, upperIndex(leaf->keys_, leaf->count_, key));
+  }
+  template <typename M>
+  btreeIterator<M> find(const K &key) const {
+    leafNode *leaf = findLeaf(key);
+    if (!leaf) return end<M>();
+    size_type pos = lowerIndex(leaf->keys_, leaf->count_, key);
+    if (pos == leaf->count_ || comp_(key, leaf->keys_[pos])) return end<M>();
+    return btreeIterator<M>(this, leaf, pos);
+  }
+
+  // Inserts key with a value built from args unless the key is present.
+  // Returns the leaf slot of the key and whether it was inserted.
+  template <typename... Args>
+  std::pair<btreeIterator<V>, bool> insertUnique(const K &key,
+                                                 Args &&...args) {
+    if (!root_) root_ = first_ = last_ = new leafNode;
+    insertResult res{nullptr, 0, false};
+    K separator;
+    node *right =
+        insertInto(root_, key, separator, res, std::forward<Args>(args)...);
+    if (right) {
+      innerNode *top = new innerNode;
+      top->keys_[0] = std::move(separator);
+      top->children_[0] = root_;
+      top->children_[1] = right;
+      top->count_ = 1;
+      root_ = top;
+    }
+    if (res.inserted_) ++count_;
+    return std::make_pair(btreeIterator<V>(this, res.leaf_, res.index_),
+                          res.inserted_);
+  }
+
+  size_type erase(const K &key) {
+    if (!root_ || !eraseFrom(root_, key)) return 0;
+    --count_;
+    if (!root_->count_) {
+      node *old = root_;
+      if (old->leaf_) {
+        root_ = first_ = last_ = nullptr;
+        delete asLeaf(old);
+      } else {
+        root_ = asInner(old)->children_[0];
+        delete asInner(old);
+      }
+    }
+    return 1;
+  }
+
+  void clear() {
+    destroyNode(root_);
+    root_ = nullptr;
+    first_ = last_ = nullptr;
+    count_ = 0;
+  }
+  void swap(BTree &other) {
+    std::swap(root_, other.root_);
+    std::swap(first_, other.first_);
+    std::swap(last_, other.last_);
+    std::swap(count_, other.count_);
+    std::swap(comp_, other.comp_);
+  }
+
+ private:
+  struct insertResult {
+    leafNode *leaf_;
+    size_type index_;
+    bool inserted_;
+  };
+
+  static leafNode *asLeaf(node *cur) { return static_cast<leafNode *>(cur); }
+  static innerNode *asInner(node *cur) {
+    return static_cast<innerNode *>(cur);
+  }
+  static const leafNode *asLeaf(const node *cur) {
+    return static_cast<const leafNode *>(cur);
+  }
+  static const innerNode *asInner(const node *cur) {
+    return static_cast<const innerNode *>(cur);
+  }
+  static size_type minCount(const node *cur) {
+    return (cur->leaf_ ? kLeafSlots : kInnerSlots) / 2;
+  }
+
+  size_type lowerIndex(const K *keys, size_type count, const K &key) const {
+    return branchlessLowerBound(keys, count, key, comp_);
+  }
+  size_type upperIndex(const K *keys, size_type count, const K &key) const {
+    return branchlessUpperBound(keys, count, key, comp_);
+  }
+  template <typename M>
+  btreeIterator<M> toIterator(leafNode *leaf, size_type pos) const {
+    if (pos == leaf->count_) return btreeIterator<M>(this, leaf->next_, 0);
+    return btreeIterator<M>(this, leaf, pos);
+  }
+  leafNode *findLeaf(const K &key) const {
+    node *cur = root_;
+    while (cur && !cur->leaf_) {
+      innerNode *inner = asInner(cur);
+      cur = inner->children_[upperIndex(inner->keys_, inner->count_, key)];
+    }
+    return asLeaf(cur);
+  }
+
+  // Slots left behind by a shift are reset, so erased keys and values
+  // are released now rather than when the node is reused or freed.
+  static void resetKeys(K *keys, size_type first, size_type last) {
+    for (size_type i = first; i < last; ++i) keys[i] = K();
+  }
+  static void resetLeafSlots(leafNode *leaf, size_type first,
+                             size_type last) {
+    resetKeys(leaf->keys_, first, last);
+    if constexpr (!std::is_void<V>::value) {
+      for (size_type i = first; i < last; ++i) leaf->values_[i] = V();
+    }
+  }
+
+  /* ----- INSERT ----- */
+
+  // Returns the new right sibling and its separator when cur split.
+  template <typename... Args>
+  node *insertInto(node *cur, const K &key, K &separator, insertResult &res,
+                   Args &&...args) {
+    if (cur->leaf_) {
+      return insertIntoLeaf(asLeaf(cur), key, separator, res,
+                            std::forward<Args>(args)...);
+    }
+    innerNode *inner = asInner(cur);
+    size_type pos = upperIndex(inner->keys_, inner->count_, key);
+    K child_separator;
+    node *right = insertInto(inner->children_[pos], key, child_separator, res,
+                             std::forward<Args>(args)...);
+    if (!right) return nullptr;
+    std::move_backward(inner->keys_ + pos, inner->keys_ + inner->count_,
+                       inner->keys_ + inner->count_ + 1);
+    std::move_backward(inner->children_ + pos + 1,
+                       inner->children_ + inner->count_ + 1,
+                       inner->children_ + inner->count_ + 2);
+    inner->keys_[pos] = std::move(child_separator);
+    inner->children_[pos + 1] = right;
+    if (++inner->count_ <= kInnerSlots) return nullptr;
+    return splitInner(inner, separator);
+  }
+
+  template <typename... Args>
+  node *insertIntoLeaf(leafNode *leaf, const K &key, K &separator,
+                       insertResult &res, Args &&...args) {
+    size_type pos = lowerIndex(leaf->keys_, leaf->count_, key);
+    if (pos < leaf->count_ && !comp_(key, leaf->keys_[pos])) {
+      res = insertResult{leaf, pos, false};
+      return nullptr;
+    }
+    if constexpr (!std::is_void<V>::value) {
+      V value(std::forward<Args>(args)...);
+      std::move_backward(leaf->values_ + pos, leaf->values_ + leaf->count_,
+                         leaf->values_ + leaf->count_ + 1);
+      leaf->values_[pos] = std::move(value);
+    }
+    std::move_backward(leaf->keys_ + pos, leaf->keys_ + leaf->count_,
+                       leaf->keys_ + leaf->count_ + 1);
+    leaf->keys_[pos] = key;
+    res = insertResult{leaf, pos, true};
+    if (++leaf->count_ <= kLeafSlots) return nullptr;
+    return splitLeaf(leaf, separator, res);
+  }
+
+  node *splitLeaf(leafNode *leaf, K &separator, insertResult &res) {
+    leafNode *right = new leafNode;
+    size_type mid = leaf->count_ / 2;
+    right->count_ = leaf->count_ - mid;
+    std::move(leaf->keys_ + mid, leaf->keys_ + leaf->count_, right->keys_);
+    if constexpr (!std::is_void<V>::value) {
+      std::move(leaf->values_ + mid, leaf->values_ + leaf->count_,
+                right->values_);
+    }
+    resetLeafSlots(leaf, mid, leaf->count_);
+    leaf->count_ = mid;
+    right->prev_ = leaf;
+    right->next_ = leaf->next_;
+    if (leaf->next_) {
+      leaf->next_->prev_ = right;
+    } else {
+      last_ = right;
+    }
+    leaf->next_ = right;
+    if (res.index_ >= mid) res = insertResult{right, res.index_ - mid, true};
+    separator = right->keys_[0];
+    return right;
+  }
+
+  node *splitInner(innerNode *inner, K &separator) {
+    innerNode *right = new innerNode;
+    size_type mid = inner->count_ / 2;
+    separator = std::move(inner->keys_[mid]);
+    right->count_ = inner->count_ - mid - 1;
+    std::move(inner->keys_ + mid + 1, inner->keys_ + inner->count_,
+              right->keys_);
+    std::copy(inner->children_ + mid + 1, inner->children_ + inner->count_ + 1,
+              right->children_);
+    resetKeys(inner->keys_, mid, inner->count_);
+    inner->count_ = mid;
+    return right;
+  }
+
+  /* ----- ERASE ----- */
+
+  bool eraseFrom(node *cur, const K &key) {
+    if (cur->leaf_) {
+      leafNode *leaf = asLeaf(cur);
+      size_type pos = lowerIndex(leaf->keys_, leaf->count_, key);
+      if (pos == leaf->count_ || comp_(key, leaf->keys_[pos])) return false;
+      std::move(leaf->keys_ + pos + 1, leaf->keys_ + leaf->count_,
+                leaf->keys_ + pos);
+      if constexpr (!std::is_void<V>::value) {
+        std::move(leaf->values_ + pos + 1, leaf->values_ + leaf->count_,
+                  leaf->values_ + pos);
+      }
+      --leaf->count_;
+      resetLeafSlots(leaf, leaf->count_, leaf->count_ + 1);
+      return true;
+    }
+    innerNode *inner = asInner(cur);
+    size_type pos = upperIndex(inner->keys_, inner->count_, key);
+    if (!eraseFrom(inner->children_[pos], key)) return false;
+    node *child = inner->children_[pos];
+    if (child->count_ < minCount(child)) rebalance(inner, pos);
+    return true;
+  }
+
+  // Refills the underfull child pos from a sibling, or merges it with one.
+  void rebalance(innerNode *parent, size_type pos) {
+    node *left = pos ? parent->children_[pos - 1] : nullptr;
+    node *right = pos < parent->count_ ? parent->children_[pos + 1] : nullptr;
+    if (left && left->count_ > minCount(left)) {
+      borrowFromLeft(parent, pos);
+    } else if (right && right->count_ > minCount(right)) {
+      borrowFromRight(parent, pos);
+    } else {
+      mergeChildren(parent, left ? pos - 1 : pos);
+    }
+  }
+
+  void borrowFromLeft(innerNode *parent, size_type pos) {
+    node *child = parent->children_[pos];
+    if (child->leaf_) {
+      leafNode *dst = asLeaf(child);
+      leafNode *src = asLeaf(parent->children_[pos - 1]);
+      std::move_backward(dst->keys_, dst->keys_ + dst->count_,
+                         dst->keys_ + dst->count_ + 1);
+      dst->keys_[0] = std::move(src->keys_[src->count_ - 1]);
+      if constexpr (!std::is_void<V>::value) {
+        std::move_backward(dst->values_, dst->values_ + dst->count_,
+                           dst->values_ + dst->count_ + 1);
+        dst->values_[0] = std::move(src->values_[src->count_ - 1]);
+      }
+      parent->keys_[pos - 1] = dst->keys_[0];
+      resetLeafSlots(src, src->count_ - 1, src->count_);
+    } else {
+      innerNode *dst = asInner(child);
+      innerNode *src = asInner(parent->children_[pos - 1]);
+      std::move_backward(dst->keys_, dst->keys_ + dst->count_,
+                         dst->keys_ + dst->count_ + 1);
+      std::move_backward(dst->children_, dst->children_ + dst->count_ + 1,
+                         dst->children_ + dst->count_ + 2);
+      dst->keys_[0] = std::move(parent->keys_[pos - 1]);
+      dst->children_[0] = src->children_[src->count_];
+      parent->keys_[pos - 1] = std::move(src->keys_[src->count_ - 1]);
+      resetKeys(src->keys_, src->count_ - 1, src->count_);
+    }
+    --parent->children_[pos - 1]->count_;
+    ++child->count_;
+  }
+
+  void borrowFromRight(innerNode *parent, size_type pos) {
+    node *child = parent->children_[pos];
+    if (child->leaf_) {
+      leafNode *dst = asLeaf(child);
+      leafNode *src = asLeaf(parent->children_[pos + 1]);
+      dst->keys_[dst->count_] = std::move(src->keys_[0]);
+      std::move(src->keys_ + 1, src->keys_ + src->count_, src->keys_);
+      if constexpr (!std::is_void<V>::value) {
+        dst->values_[dst->count_] = std::move(src->values_[0]);
+        std::move(src->values_ + 1, src->values_ + src->count_, src->values_);
+      }
+      parent->keys_[pos] = src->keys_[0];
+      resetLeafSlots(src, src->count_ - 1, src->count_);
+    } else {
+      innerNode *dst = asInner(child);
+      innerNode *src = asInner(parent->children_[pos + 1]);
+      dst->keys_[dst->count_] = std::move(parent->keys_[pos]);
+      dst->children_[dst->count_ + 1] = src->children_[0];
+      parent->keys_[pos] = std::move(src->keys_[0]);
+      std::move(src->keys_ + 1, src->keys_ + src->count_, src->keys_);
+      std::copy(src->children_ + 1, src->children_ + src->count_ + 1,
+                src->children_);
+      resetKeys(src->keys_, src->count_ - 1, src->count_);
+    }
+    --parent->children_[pos + 1]->count_;
+    ++child->count_;
+  }
+
+  // Folds child pos + 1 into child pos and drops their separator.
+  void mergeChildren(innerNode *parent, size_type pos) {
+    node *left = parent->children_[pos];
+    node *right = parent->children_[pos + 1];
+    if (left->leaf_) {
+      leafNode *dst = asLeaf(left);
+      leafNode *src = asLeaf(right);
+      std::move(src->keys_, src->keys_ + src->count_, dst->keys_ + dst->count_);
+      if constexpr (!std::is_void<V>::value) {
+        std::move(src->values_, src->values_ + src->count_,
+                  dst->values_ + dst->count_);
+      }
+      dst->count_ += src->count_;
+      dst->next_ = src->next_;
+      if (src->next_) {
+        src->next_->prev_ = dst;
+      } else {
+        last_ = dst;
+      }
+      delete src;
+    } else {
+      innerNode *dst = asInner(left);
+      innerNode *src = asInner(right);
+      dst->keys_[dst->count_] = std::move(parent->keys_[pos]);
+      std::move(src->keys_, src->keys_ + src->count_,
+                dst->keys_ + dst->count_ + 1);
+      std::copy(src->children_, src->children_ + src->count_ + 1,
+                dst->children_ + dst->count_ + 1);
+      dst->count_ += src->count_ + 1;
+      delete src;
+    }
+    std::move(parent->keys_ + pos + 1, parent->keys_ + parent->count_,
+              parent->keys_ + pos);
+    std::copy(parent->children_ + pos + 2,
+              parent->children_ + parent->count_ + 1,
+              parent->children_ + pos + 1);
+    --parent->count_;
+    resetKeys(parent->keys_, parent->count_, parent->count_ + 1);
+  }
+
+  /* ----- LIFETIME ----- */
+
+  // Copies src and links the copied leaves after prev, left to right. A
+  // throwing copy frees everything this call built.
+  node *cloneNode(const node *src, leafNode *&prev) {
+    if (src->leaf_) {
+      const leafNode *from = asLeaf(src);
+      leafNode *leaf = new leafNode;
+      try {
+        std::copy(from->keys_, from->keys_ + from->count_, leaf->keys_);
+        if constexpr (!std::is_void<V>::value) {
+          std::copy(from->values_, from->values_ + from->count_,
+                    leaf->values_);
+        }
+      } catch (...) {
+        delete leaf;
+        throw;
+      }
+      leaf->count_ = from->count_;
+      leaf->prev_ = prev;
+      if (prev) prev->next_ = leaf;
+      prev = leaf;
+      return leaf;
+    }
+    const innerNode *from = asInner(src);
+    innerNode *inner = new innerNode;
+    size_type built = 0;
+    try {
+      std::copy(from->keys_, from->keys_ + from->count_, inner->keys_);
+      for (; built <= from->count_; ++built) {
+        inner->children_[built] = cloneNode(from->children_[built], prev);
+      }
+    } catch (...) {
+      for (size_type i = 0; i < built; ++i) destroyNode(inner->children_[i]);
+      delete inner;
+      throw;
+    }
+    inner->count_ = from->count_;
+    return inner;
+  }
+
+  void destroyNode(node *cur) {
+    if (!cur) return;
+    if (cur->leaf_) {
+      delete asLeaf(cur);
+      return;
+    }
+    innerNode *inner = asInner(cur);
+    for (size_type i = 0; i <= inner->count_; ++i) {
+      destroyNode(inner->children_[i]);
+    }
+    delete inner;
+  }
+
+  node *root_ = nullptr;
+  leafNode *first_ = nullptr;
+  leafNode *last_ = nullptr;
+  size_type count_ = 0;
+  Compare comp_;
+};
+}  // namespace s21
+#endif  // CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_BTREE_H_
@@ -0,0 +1,136 @@
+#ifndef CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_BTREE_MAP_H_
+#define CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_BTREE_MAP_H_
+
+#include <initializer_list>
+#include <stdexcept>
+
+#include "btree.h"
+
+namespace s21 {
+// map on the B+tree backend; see BTree. Offers the lookup, insert,
+// erase and ordered-iteration part of the map interface.
+template <typename K, typename V, typename Compare = std::less<K>,
+          size_t NodeBytes = 256>
+class btree_map {
+ public:
+  using tree = BTree<K, V, Compare, NodeBytes>;
+  using key_type = K;
+  using mapped_type = V;
+  using key_compare = Compare;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using iterator = typename tree::template btreeIterator<mapped_type>;
+  using const_iterator =
+      typename tree::template btreeIterator<const mapped_type>;
+  using size_type = size_t;
+
+  // CONSTRUCTORS
+  btree_map() = default;
+  explicit btree_map(const Compare &comp) : tree_(comp) {}
+  btree_map(std::initializer_list<value_type> const &items,
+            const Compare &comp = Compare())
+      : tree_(comp) {
+    for (const value_type &item : items) insert(item);
+  }
+  btree_map(const btree_map &other) : tree_(other.tree_) {}
+  btree_map(btree_map &&other) : tree_(std::move(other.tree_)) {}
+
+  // DESTRUCTOR
+  ~btree_map() = default;
+
+  // OVERLOAD OPERATORS
+  btree_map &operator=(const btree_map &other) {
+    tree_ = other.tree_;
+    return *this;
+  }
+  btree_map &operator=(btree_map &&other) {
+    tree_ = std::move(other.tree_);
+    return *this;
+  }
+  mapped_type &operator[](const key_type &key) {
+    return tree_.insertUnique(key).first->value_;
+  }
+
+  mapped_type &at(const key_type &key) {
+    iterator res = find(key);
+    if (res == end()) throw std::out_of_range("Key does not exist");
+    return res->value_;
+  }
+  const mapped_type &at(const key_type &key) const {
+    const_iterator res = find(key);
+    if (res == end()) throw std::out_of_range("Key does not exist");
+    return res->value_;
+  }
+
+  // ITERATORS
+  iterator begin() { return tree_.template begin<mapped_type>(); }
+  const_iterator begin() const {
+    return tree_.template begin<const mapped_type>();
+  }
+  iterator end() { return tree_.template end<mapped_type>(); }
+  const_iterator end() const {
+    return tree_.template end<const mapped_type>();
+  }
+
+  // MAIN FUNCTIONS
+  bool empty() const { return !tree_.size(); }
+  size_type size() const { return tree_.size(); }
+  size_type max_size() const {
+    return std::numeric_limits<std::ptrdiff_t>::max() /
+           (sizeof(key_type) + sizeof(mapped_type));
+  }
+  key_compare key_comp() const { return tree_.key_comp(); }
+  // Number of node levels from the root down to the leaves.
+  size_type height() const { return tree_.height(); }
+
+  iterator find(const key_type &key) {
+    return tree_.template find<mapped_type>(key);
+  }
+  const_iterator find(const key_type &key) const {
+    return tree_.template find<const mapped_type>(key);
+  }
+  bool contains(const key_type &key) const { return find(key) != end(); }
+
+  iterator lower_bound(const key_type &key) {
+    return tree_.template lowerBound<mapped_type>(key);
+  }
+  const_iterator lower_bound(const key_type &key) const {
+    return tree_.template lowerBound<const mapped_type>(key);
+  }
+  iterator upper_bound(const key_type &key) {
+    return tree_.template upperBound<mapped_type>(key);
+  }
+  const_iterator upper_bound(const key_type &key) const {
+    return tree_.template upperBound<const mapped_type>(key);
+  }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return tree_.insertUnique(value.first, value.second);
+  }
+  std::pair<iterator, bool> insert(const key_type &key,
+                                   const mapped_type &obj) {
+    return tree_.insertUnique(key, obj);
+  }
+  std::pair<iterator, bool> insert_or_assign(const key_type &key,
+                                             const mapped_type &obj) {
+    auto res = tree_.insertUnique(key, obj);
+    if (!res.second) res.first->value_ = obj;
+    return res;
+  }
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const key_type &key, Args &&...args) {
+    return tree_.insertUnique(key, std::forward<Args>(args)...);
+  }
+
+  void erase(iterator pos) {
+    key_type key = pos->key_;
+    tree_.erase(key);
+  }
+  size_type erase(const key_type &key) { return tree_.erase(key); }
+  void swap(btree_map &other) { tree_.swap(other.tree_); }
+  void clear() { tree_.clear(); }
+
+ private:
+  tree tree_;
+};
+}  // namespace s21
+#endif  // CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_BTREE_MAP_H_
@@ -0,0 +1,90 @@
+#ifndef CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_BTREE_SET_H_
+#define CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_BTREE_SET_H_
+
+#include <initializer_list>
+
+#include "btree.h"
+
+namespace s21 {
+// set on the B+tree backend; see BTree. Offers the lookup, insert,
+// erase and ordered-iteration part of the set interface.
+template <typename T, typename Compare = std::less<T>,
+          size_t NodeBytes = 256>
+class btree_set {
+ public:
+  using tree = BTree<T, void, Compare, NodeBytes>;
+  using key_type = T;
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = typename tree::template btreeIterator<void>;
+  using const_iterator = iterator;
+  using size_type = size_t;
+  using key_compare = Compare;
+
+  // CONSTRUCTORS
+  btree_set() = default;
+  explicit btree_set(const Compare &comp) : tree_(comp) {}
+  btree_set(std::initializer_list<value_type> const &items,
+            const Compare &comp = Compare())
+      : tree_(comp) {
+    for (const value_type &item : items) insert(item);
+  }
+  btree_set(const btree_set &other) : tree_(other.tree_) {}
+  btree_set(btree_set &&other) : tree_(std::move(other.tree_)) {}
+
+  // DESTRUCTOR
+  ~btree_set() = default;
+
+  // OVERLOAD OPERATORS
+  btree_set &operator=(const btree_set &other) {
+    tree_ = other.tree_;
+    return *this;
+  }
+  btree_set &operator=(btree_set &&other) {
+    tree_ = std::move(other.tree_);
+    return *this;
+  }
+
+  // MAIN FUNCTIONS
+  bool empty() const { return !tree_.size(); }
+  size_type size() const { return tree_.size(); }
+  size_type max_size() const {
+    return std::numeric_limits<std::ptrdiff_t>::max() / sizeof(key_type);
+  }
+  key_compare key_comp() const { return tree_.key_comp(); }
+  key_compare value_comp() const { return tree_.key_comp(); }
+  // Number of node levels from the root down to the leaves.
+  size_type height() const { return tree_.height(); }
+  void swap(btree_set &other) { tree_.swap(other.tree_); }
+  void clear() { tree_.clear(); }
+
+  iterator find(const value_type &key) const {
+    return tree_.template find<void>(key);
+  }
+  bool contains(const value_type &key) const { return find(key) != end(); }
+  iterator lower_bound(const key_type &key) const {
+    return tree_.template lowerBound<void>(key);
+  }
+  iterator upper_bound(const key_type &key) const {
+    return tree_.template upperBound<void>(key);
+  }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return tree_.insertUnique(value);
+  }
+  void erase(iterator pos) {
+    key_type key = *pos;
+    tree_.erase(key);
+  }
+  size_type erase(const key_type &key) { return tree_.erase(key); }
+
+  // ITERATORS FUNCTIONS
+  iterator begin() const { return tree_.template begin<void>(); }
+  iterator end() const { return tree_.template end<void>(); }
+
+ private:
+  tree tree_;
+};
+}  // namespace s21
+#endif  // CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_BTREE_SET_H_
@@ -0,0 +1,186 @@
+#ifndef CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_CONCURRENT_MAP_H_
+#define CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_CONCURRENT_MAP_H_
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+
+#include "persistent_map.h"
+
+namespace s21 {
+// Map for many readers and rare writers. Each write builds the next
+// version with persistent_map path copying and publishes it with one
+// atomic store, so readers never block and never see a half-done
+// rotation. Replaced versions are reclaimed by epochs: a reader
+// announces the epoch it started in, and a version retired in epoch e
+// is freed once no active reader announced e or earlier.
+//
+// Lookups go through a reader, which holds one of MaxReaders
+// announcement slots; reader lookups are wait-free. Writers are
+// serialized by a mutex.
+template <typename K, typename V, typename Compare = std::less<K>,
+          size_t MaxReaders = 128>
+class concurrent_map {
+ public:
+  using key_type = K;
+  using mapped_type = V;
+  using key_compare = Compare;
+  using size_type = size_t;
+  using snapshot_type = persistent_map<K, V, Compare>;
+
+ private:
+  struct version {
+    explicit version(const snapshot_type &map) : map_(map) {}
+
+    const snapshot_type map_;
+    uint64_t retired_at_ = 0;
+    version *next_ = nullptr;
+  };
+  // One per cache line so readers do not contend on announcements.
+  struct alignas(64) readerSlot {
+    std::atomic<uint64_t> epoch_{0};
+    std::atomic<bool> used_{false};
+  };
+
+ public:
+  // Registers the calling thread as a reader for its lifetime. Each
+  // lookup runs inside its own read-side critical section.
+  class reader {
+   public:
+    explicit reader(concurrent_map &map) : map_(map), slot_(map.claimSlot()) {}
+    reader(const reader &) = delete;
+    reader &operator=(const reader &) = delete;
+    ~reader() { slot_->used_.store(false, std::memory_order_release); }
+
+    bool contains(const key_type &key) {
+      const version *cur = enter();
+      bool res = cur->map_.contains(key);
+      leave();
+      return res;
+    }
+    // Copies the value out, since the version may be freed afterwards.
+    std::optional<mapped_type> find(const key_type &key) {
+      const version *cur = enter();
+      std::optional<mapped_type> res;
+      auto it = cur->map_.find(key);
+      if (it != cur->map_.end()) res = it->value_;
+      leave();
+      return res;
+    }
+    size_type size() {
+      const version *cur = enter();
+      size_type res = cur->map_.size();
+      leave();
+      return res;
+    }
+
+   private:
+    const version *enter() {
+      slot_->epoch_.store(map_.epoch_.load());
+      return map_.current_.load();
+    }
+    void leave() { slot_->epoch_.store(0, std::memory_order_release); }
+
+    concurrent_map &map_;
+    readerSlot *slot_;
+  };
+
+  // CONSTRUCTORS
+  concurrent_map() : current_(new version(snapshot_type())) {}
+  explicit concurrent_map(const Compare &comp)
+      : current_(new version(snapshot_type(comp))) {}
+  concurrent_map(const concurrent_map &) = delete;
+  concurrent_map &operator=(const concurrent_map &) = delete;
+
+  // DESTRUCTOR
+  // All readers must be gone by now.
+  ~concurrent_map() {
+    delete current_.load();
+    freeRetired(std::numeric_limits<uint64_t>::max());
+  }
+
+  // WRITER FUNCTIONS
+  bool insert(const key_type &key, const mapped_type &obj) {
+    return write(
+        [&](snapshot_type &map) { return map.insert(key, obj).second; });
+  }
+  bool insert_or_assign(const key_type &key, const mapped_type &obj) {
+    return write([&](snapshot_type &map) {
+      return map.insert_or_assign(key, obj).second;
+    });
+  }
+  size_type erase(const key_type &key) {
+    return write([&](snapshot_type &map) { return map.erase(key); });
+  }
+
+  // A stable copy of the current version; O(1).
+  snapshot_type snapshot() {
+    std::lock_guard<std::mutex> lock(writer_mutex_);
+    return current_.load()->map_;
+  }
+
+ private:
+  readerSlot *claimSlot() {
+    for (readerSlot &slot : slots_) {
+      bool expected = false;
+      if (!slot.used_.load(std::memory_order_relaxed) &&
+          slot.used_.compare_exchange_strong(expected, true,
+                                             std::memory_order_acquire)) {
+        return &slot;
+      }
+    }
+    throw std::runtime_error("No free reader slots");
+  }
+
+  // Applies change to a copy of the current version, publishes the copy
+  // and retires the old version.
+  template <typename Change>
+  auto write(Change change) {
+    std::lock_guard<std::mutex> lock(writer_mutex_);
+    version *old = current_.load(std::memory_order_relaxed);
+    snapshot_type next_map(old->map_);
+    auto res = change(next_map);
+    if (next_map.shares_root(old->map_)) return res;
+    current_.store(new version(next_map));
+    old->retired_at_ = epoch_.fetch_add(1);
+    old->next_ = retired_;
+    retired_ = old;
+    freeRetired(oldestReader());
+    return res;
+  }
+
+  // Smallest epoch announced by an active reader.
+  uint64_t oldestReader() const {
+    uint64_t oldest = std::numeric_limits<uint64_t>::max();
+    for (const readerSlot &slot : slots_) {
+      uint64_t epoch = slot.epoch_.load();
+      if (epoch && epoch < oldest) oldest = epoch;
+    }
+    return oldest;
+  }
+  // Frees the versions retired before epoch oldest.
+  void freeRetired(uint64_t oldest) {
+    version **link = &retired_;
+    while (*link) {
+      version *cur = *link;
+      if (cur->retired_at_ < oldest) {
+        *link = cur->next_;
+        delete cur;
+      } else {
+        link = &cur->next_;
+      }
+    }
+  }
+
+  std::atomic<version *> current_;
+  std::atomic<uint64_t> epoch_{1};
+  readerSlot slots_[MaxReaders];
+  std::mutex writer_mutex_;
+  version *retired_ = nullptr;
+};
+}  // namespace s21
+#endif  // CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_CONCURRENT_MAP_H_
@@ -0,0 +1,439 @@
+#ifndef CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_FLAT_MAP_H_
+#define CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_FLAT_MAP_H_
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "flat_search.h"
+#include "vector.h"
+
+namespace s21 {
+// Sorted-array map for read-mostly tables: keys and values live in two
+// contiguous vectors, so lookups binary search a dense key array instead
+// of chasing tree pointers. Inserting or erasing a single element shifts
+// the tail and costs O(n); insert_sorted merges a whole batch in
+// O(n + m). Storage is s21::Vector, which default-constructs its slots,
+// so keys and values must be default-constructible.
+template <typename K, typename V, typename Compare = std::less<K>>
+class flat_map {
+ public:
+  using key_type = K;
+  using mapped_type = V;
+  using key_compare = Compare;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using size_type = size_t;
+
+  // Element view with the same key_/value_ members as a map node.
+  template <typename M>
+  struct flatReference {
+    const key_type &key_;
+    M &value_;
+
+    const flatReference *operator->() const { return this; }
+  };
+
+  template <typename M>
+  class flatIterator {
+   public:
+    /* ----- TYPES ----- */
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = flatReference<M>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = flatReference<M>;
+    using reference = flatReference<M>;
+
+    flatIterator() : key_(nullptr), value_(nullptr){};
+    flatIterator(const key_type *key, M *value) : key_(key), value_(value){};
+    template <typename N, typename = std::enable_if_t<
+                              std::is_same<const N, M>::value &&
+                              !std::is_same<N, M>::value>>
+    flatIterator(const flatIterator<N> &other)
+        : key_(other.key_), value_(other.value_) {}
+
+    flatIterator &operator++() {
+      ++key_;
+      ++value_;
+      return *this;
+    }
+    flatIterator &operator--() {
+      --key_;
+      --value_;
+      return *this;
+    }
+    flatIterator operator++(int) {
+      flatIterator ret_it(*this);
+      ++(*this);
+      return ret_it;
+    }
+    flatIterator operator--(int) {
+      flatIterator ret_it(*this);
+      --(*this);
+      return ret_it;
+    }
+    flatIterator &operator+=(difference_type n) {
+      key_ += n;
+      value_ += n;
+      return *this;
+    }
+    flatIterator operator+(difference_type n) const {
+      return flatIterator(key_ + n, value_ + n);
+    }
+    flatIterator operator-(difference_type n) const {
+      return flatIterator(key_ - n, value_ - n);
+    }
+    difference_type operator-(const flatIterator &other) const {
+      return key_ - other.key_;
+    }
+
+    bool operator==(const flatIterator &other) const {
+      return key_ == other.key_;
+    }
+    bool operator!=(const flatIterator &other) const {
+      return key_ != other.key_;
+    }
+    bool operator<(const flatIterator &other) const {
+      return key_ < other.key_;
+    }
+
+    reference operator*() const { return reference{*key_, *value_}; }
+    pointer operator->() const { return pointer{*key_, *value_}; }
+
+   private:
+    template <typename>
+    friend class flatIterator;
+
+    const key_type *key_;
+    M *value_;
+  };
+
+  using iterator = flatIterator<mapped_type>;
+  using const_iterator = flatIterator<const mapped_type>;
+
+  // CONSTRUCTORS
+  flat_map() = default;
+  explicit flat_map(const Compare &comp) : comp_(comp) {}
+  flat_map(std::initializer_list<value_type> const &items,
+           const Compare &comp = Compare())
+      : comp_(comp) {
+    insert_sorted(items.begin(), items.end());
+  }
+  flat_map(const flat_map &other)
+      : keys_(other.keys_), values_(other.values_), comp_(other.comp_) {}
+  flat_map(flat_map &&other) : comp_(other.comp_) { swap(other); }
+
+  // Builds from a range sorted by comp in O(n); see insert_sorted.
+  template <typename InputIt>
+  static flat_map from_sorted(InputIt first, InputIt last,
+                              const Compare &comp = Compare()) {
+    flat_map result(comp);
+    result.insert_sorted(first, last);
+    return result;
+  }
+
+  // DESTRUCTOR
+  ~flat_map() = default;
+
+  // OVERLOAD OPERATORS
+  flat_map &operator=(const flat_map &other) {
+    flat_map cpy(other);
+    swap(cpy);
+    return *this;
+  }
+  flat_map &operator=(flat_map &&other) {
+    swap(other);
+    return *this;
+  }
+  mapped_type &operator[](const key_type &key) {
+    size_type pos = insertUnique(key).first;
+    return values_.data()[pos];
+  }
+  mapped_type &operator[](key_type &&key) {
+    size_type pos = insertUnique(std::move(key)).first;
+    return values_.data()[pos];
+  }
+
+  mapped_type &at(const key_type &key) {
+    size_type pos = indexOf(key);
+    if (pos == size()) throw std::out_of_range("Key does not exist");
+    return values_.data()[pos];
+  }
+  const mapped_type &at(const key_type &key) const {
+    size_type pos = indexOf(key);
+    if (pos == size()) throw std::out_of_range("Key does not exist");
+    return values_.data()[pos];
+  }
+  template <typename L, typename C = Compare,
+            typename = typename C::is_transparent>
+  mapped_type &at(const L &key) {
+    size_type pos = indexOf(key);
+    if (pos == size()) throw std::out_of_range("Key does not exist");
+    return values_.data()[pos];
+  }
+
+  // ITERATORS
+  iterator begin() { return toIterator(0); }
+  const_iterator begin() const { return toIterator(0); }
+  iterator end() { return toIterator(size()); }
+  const_iterator end() const { return toIterator(size()); }
+
+  // MAIN FUNCTIONS
+  bool empty() const { return keys_.empty(); }
+  size_type size() const { return keys_.size(); }
+  size_type max_size() const {
+    return std::numeric_limits<std::ptrdiff_t>::max() /
+           (sizeof(key_type) + sizeof(mapped_type));
+  }
+  key_compare key_comp() const { return comp_; }
+
+  iterator find(const key_type &key) { return toIterator(indexOf(key)); }
+  const_iterator find(const key_type &key) const {
+    return toIterator(indexOf(key));
+  }
+  template <typename L, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const L &key) {
+    return toIterator(indexOf(key));
+  }
+  template <typename L, typename C = Compare,
+            typename = typename C::is_transparent>
+  const_iterator find(const L &key) const {
+    return toIterator(indexOf(key));
+  }
+  bool contains(const key_type &key) const { return indexOf(key) != size(); }
+  template <typename L, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const L &key) const {
+    return indexOf(key) != size();
+  }
+
+  iterator lower_bound(const key_type &key) {
+    return toIterator(lowerIndex(key));
+  }
+  const_iterator lower_bound(const key_type &key) const {
+    return toIterator(lowerIndex(key));
+  }
+  template <typename L, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator lower_bound(const L &key) {
+    return toIterator(lowerIndex(key));
+  }
+  template <typename L, typename C = Compare,
+            typename = typename C::is_transparent>
+  const_iterator lower_bound(const L &key) const {
+    return toIterator(lowerIndex(key));
+  }
+  iterator upper_bound(const key_type &key) {
+    return toIterator(upperIndex(key));
+  }
+  const_iterator upper_bound(const key_type &key) const {
+    return toIterator(upperIndex(key));
+  }
+  template <typename L, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator upper_bound(const L &key) {
+    return toIterator(upperIndex(key));
+  }
+  template <typename L, typename C = Compare,
+            typename = typename C::is_transparent>
+  const_iterator upper_bound(const L &key) const {
+    return toIterator(upperIndex(key));
+  }
+  std::pair<iterator, iterator> equal_range(const key_type &key) {
+    return equalIndices(key, *this);
+  }
+  std::pair<const_iterator, const_iterator> equal_range(
+      const key_type &key) const {
+    return equalIndices(key, *this);
+  }
+  template <typename L, typename C = Compare,
+            typename = typename C::is_transparent>
+  std::pair<iterator, iterator> equal_range(const L &key) {
+    return equalIndices(key, *this);
+  }
+  template <typename L, typename C = Compare,
+            typename = typename C::is_transparent>
+  std::pair<const_iterator, const_iterator> equal_range(const L &key) const {
+    return equalIndices(key, *this);
+  }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return insert(value.first, value.second);
+  }
+  std::pair<iterator, bool> insert(value_type &&value) {
+    auto res = insertUnique(value.first, std::move(value.second));
+    return std::make_pair(toIterator(res.first), res.second);
+  }
+  std::pair<iterator, bool> insert(const key_type &key,
+                                   const mapped_type &obj) {
+    auto res = insertUnique(key, obj);
+    return std::make_pair(toIterator(res.first), res.second);
+  }
+  std::pair<iterator, bool> insert(key_type &&key, mapped_type &&obj) {
+    auto res = insertUnique(std::move(key), std::move(obj));
+    return std::make_pair(toIterator(res.first), res.second);
+  }
+  std::pair<iterator, bool> insert_or_assign(const key_type &key,
+                                             const mapped_type &obj) {
+    auto res = insertUnique(key, obj);
+    if (!res.second) values_.data()[res.first] = obj;
+    return std::make_pair(toIterator(res.first), res.second);
+  }
+  std::pair<iterator, bool> insert_or_assign(key_type &&key,
+                                             mapped_type &&obj) {
+    auto res = insertUnique(std::move(key), std::move(obj));
+    if (!res.second) values_.data()[res.first] = std::move(obj);
+    return std::make_pair(toIterator(res.first), res.second);
+  }
+  // Builds the pair first, since the key is needed to find its slot.
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    std::pair<key_type, mapped_type> item(std::forward<Args>(args)...);
+    auto res = insertUnique(std::move(item.first), std::move(item.second));
+    return std::make_pair(toIterator(res.first), res.second);
+  }
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const key_type &key, Args &&...args) {
+    auto res = insertUnique(key, std::forward<Args>(args)...);
+    return std::make_pair(toIterator(res.first), res.second);
+  }
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(key_type &&key, Args &&...args) {
+    auto res = insertUnique(std::move(key), std::forward<Args>(args)...);
+    return std::make_pair(toIterator(res.first), res.second);
+  }
+  // Merges a sorted batch in O(n + m), keeping the existing value and
+  // the first of equivalent new ones like insert does. An unsorted batch
+  // is inserted one element at a time.
+  template <typename InputIt>
+  void insert_sorted(InputIt first, InputIt last) {
+    Vector<key_type> keys;
+    Vector<mapped_type> values;
+    for (; first != last; ++first) {
+      if (!keys.empty()) {
+        const key_type &prev = keys.data()[keys.size() - 1];
+        if (!comp_(prev, first->first)) {
+          if (comp_(first->first, prev)) break;
+          continue;
+        }
+      }
+      flatGrow(keys, &values);
+      keys.push_back(first->first);
+      values.push_back(first->second);
+    }
+    mergeSorted(keys, values);
+    for (; first != last; ++first) insert(first->first, first->second);
+  }
+
+  void erase(iterator pos) { eraseIndices(pos - begin(), pos - begin() + 1); }
+  // Removes the keys in [lo, hi) with one shift of the tail and returns
+  // how many were removed.
+  size_type erase_range(const key_type &lo, const key_type &hi) {
+    if (!comp_(lo, hi)) return 0;
+    size_type first = lowerIndex(lo);
+    size_type last = lowerIndex(hi);
+    eraseIndices(first, last);
+    return last - first;
+  }
+  void swap(flat_map &other) {
+    keys_.swap(other.keys_);
+    values_.swap(other.values_);
+    std::swap(comp_, other.comp_);
+  }
+  // Moves over the entries of other whose keys are missing here; the
+  // rest stay in other.
+  void merge(flat_map &other) {
+    if (&other == this) return;
+    flat_map moved(comp_);
+    flat_map rest(other.comp_);
+    for (size_type i = 0; i < other.size(); ++i) {
+      flat_map &target = contains(other.keyAt(i)) ? rest : moved;
+      flatGrow(target.keys_, &target.values_);
+      target.keys_.push_back(std::move(other.keys_.data()[i]));
+      target.values_.push_back(std::move(other.values_.data()[i]));
+    }
+    mergeSorted(moved.keys_, moved.values_);
+    other.swap(rest);
+  }
+
+  void clear() {
+    Vector<key_type>().swap(keys_);
+    Vector<mapped_type>().swap(values_);
+  }
+
+ private:
+  const key_type &keyAt(size_type pos) const { return keys_.data()[pos]; }
+  iterator toIterator(size_type pos) {
+    return iterator(keys_.data() + pos, values_.data() + pos);
+  }
+  const_iterator toIterator(size_type pos) const {
+    return const_iterator(keys_.data() + pos, values_.data() + pos);
+  }
+  template <typename L>
+  size_type lowerIndex(const L &key) const {
+    return branchlessLowerBound(keys_.data(), size(), key, comp_);
+  }
+  template <typename L>
+  size_type upperIndex(const L &key) const {
+    return branchlessUpperBound(keys_.data(), size(), key, comp_);
+  }
+  template <typename L>
+  size_type indexOf(const L &key) const {
+    size_type pos = lowerIndex(key);
+    return pos != size() && !comp_(key, keyAt(pos)) ? pos : size();
+  }
+  // Shared by the const and non-const equal_range; self picks which
+  // iterator type comes back.
+  template <typename L, typename Self>
+  static auto equalIndices(const L &key, Self &self) {
+    size_type pos = self.lowerIndex(key);
+    size_type last =
+        pos + (pos != self.size() && !self.comp_(key, self.keyAt(pos)));
+    return std::make_pair(self.toIterator(pos), self.toIterator(last));
+  }
+
+  // Builds the value from args only when key is missing.
+  template <typename KeyArg, typename... Args>
+  std::pair<size_type, bool> insertUnique(KeyArg &&key, Args &&...args) {
+    size_type pos = lowerIndex(key);
+    if (pos != size() && !comp_(key, keyAt(pos)))
+      return std::make_pair(pos, false);
+    key_type new_key(std::forward<KeyArg>(key));
+    mapped_type obj(std::forward<Args>(args)...);
+    flatGrow(keys_, &values_);
+    keys_.push_back(std::move(new_key));
+    values_.push_back(std::move(obj));
+    std::rotate(keys_.data() + pos, keys_.data() + size() - 1,
+                keys_.data() + size());
+    std::rotate(values_.data() + pos, values_.data() + size() - 1,
+                values_.data() + size());
+    return std::make_pair(pos, true);
+  }
+  void eraseIndices(size_type first, size_type last) {
+    if (first >= last) return;
+    size_type count = size();
+    std::move(keys_.data() + last, keys_.data() + count, keys_.data() + first);
+    std::move(values_.data() + last, values_.data() + count,
+              values_.data() + first);
+    for (size_type i = first + count - last; i < count; ++i) {
+      keys_.data()[i] = key_type();
+      values_.data()[i] = mapped_type();
+      keys_.pop_back();
+      values_.pop_back();
+    }
+  }
+  void mergeSorted(Vector<key_type> &keys, Vector<mapped_type> &values) {
+    flatMergeSorted(keys_, &values_, keys, &values, comp_);
+  }
+
+  Vector<key_type> keys_;
+  Vector<mapped_type> values_;
+  Compare comp_;
+};
+}  // namespace s21
+#endif  // CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_FLAT_MAP_H_
@@ -0,0 +1,111 @@
+#ifndef CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_FLAT_SEARCH_H_
+#define CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_FLAT_SEARCH_H_
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "vector.h"
+
+namespace s21 {
+// Binary searches over a sorted array. The loop runs a fixed number of
+// times for a given size and each step only picks between two bases, so
+// compilers turn it into a conditional move instead of a branch that
+// mispredicts on every other probe.
+template <typename T, typename L, typename Compare>
+size_t branchlessLowerBound(const T *first, size_t size, const L &key,
+                            const Compare &comp) {
+  if (!size) return 0;
+  const T *base = first;
+  while (size > 1) {
+    size_t half = size / 2;
+    base = comp(base[half - 1], key) ? base + half : base;
+    size -= half;
+  }
+  return static_cast<size_t>(base - first) + (comp(*base, key) ? 1 : 0);
+}
+
+template <typename T, typename L, typename Compare>
+size_t branchlessUpperBound(const T *first, size_t size, const L &key,
+                            const Compare &comp) {
+  if (!size) return 0;
+  const T *base = first;
+  while (size > 1) {
+    size_t half = size / 2;
+    base = comp(key, base[half - 1]) ? base : base + half;
+    size -= half;
+  }
+  return static_cast<size_t>(base - first) + (comp(key, *base) ? 0 : 1);
+}
+
+// Shared array maintenance for flat_map (keys plus a parallel values
+// array) and flat_set (keys only, V = flatNoValues).
+struct flatNoValues {};
+
+// Vector grows by one slot at a time, so capacity is doubled here
+// before appending.
+template <typename K, typename V = flatNoValues>
+void flatGrow(Vector<K> &keys, Vector<V> *values = nullptr) {
+  if (keys.size() < keys.capacity()) return;
+  size_t capacity = keys.capacity() ? keys.capacity() * 2 : 8;
+  keys.reserve(capacity);
+  if constexpr (!std::is_same<V, flatNoValues>::value) {
+    values->reserve(capacity);
+  }
+}
+
+// Merges a sorted, duplicate-free batch into sorted arrays in O(n + m):
+// a forward pass drops batch keys already present, then a backward pass
+// moves every element at most once.
+template <typename K, typename V = flatNoValues, typename Compare>
+void flatMergeSorted(Vector<K> &keys, Vector<V> *values, Vector<K> &batch,
+                     Vector<V> *batch_values, const Compare &comp) {
+  constexpr bool kHasValues = !std::is_same<V, flatNoValues>::value;
+  size_t old_size = keys.size();
+  const K *existing = keys.data();
+  K *batch_keys = batch.data();
+  size_t added = 0;
+  for (size_t i = 0, j = 0; i < batch.size(); ++i) {
+    while (j != old_size && comp(existing[j], batch_keys[i])) ++j;
+    if (j != old_size && !comp(batch_keys[i], existing[j])) continue;
+    if (added != i) {
+      batch_keys[added] = std::move(batch_keys[i]);
+      if constexpr (kHasValues) {
+        batch_values->data()[added] = std::move(batch_values->data()[i]);
+      }
+    }
+    ++added;
+  }
+  if (!added) return;
+  size_t new_size = old_size + added;
+  if (keys.capacity() < new_size) {
+    keys.reserve(new_size);
+    if constexpr (kHasValues) values->reserve(new_size);
+  }
+  for (size_t i = 0; i < added; ++i) {
+    keys.push_back(K());
+    if constexpr (kHasValues) values->push_back(V());
+  }
+  K *key_out = keys.data();
+  size_t lhs = old_size;
+  size_t rhs = added;
+  for (size_t out = new_size; rhs;) {
+    --out;
+    if (lhs && comp(batch_keys[rhs - 1], key_out[lhs - 1])) {
+      --lhs;
+      key_out[out] = std::move(key_out[lhs]);
+      if constexpr (kHasValues) {
+        values->data()[out] = std::move(values->data()[lhs]);
+      }
+    } else {
+      --rhs;
+      key_out[out] = std::move(batch_keys[rhs]);
+      if constexpr (kHasValues) {
+        values->data()[out] = std::move(batch_values->data()[rhs]);
+      }
+    }
+  }
+}
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_FLAT_SEARCH_H_
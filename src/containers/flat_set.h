@@ -0,0 +1,232 @@
+#ifndef CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_FLAT_SET_H_
+#define CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_FLAT_SET_H_
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <utility>
+
+#include "flat_search.h"
+#include "vector.h"
+
+namespace s21 {
+// Sorted-array set for read-mostly tables; see flat_map. Iterators are
+// plain pointers into the key array and stay valid until the next
+// insert or erase. Like flat_map, needs default-constructible keys.
+template <typename T, typename Compare = std::less<T>>
+class flat_set {
+ public:
+  using key_type = T;
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = const T *;
+  using const_iterator = const T *;
+  using size_type = size_t;
+  using key_compare = Compare;
+
+  // CONSTRUCTORS
+  flat_set() = default;
+  explicit flat_set(const Compare &comp) : comp_(comp) {}
+  flat_set(std::initializer_list<value_type> const &items,
+           const Compare &comp = Compare())
+      : comp_(comp) {
+    insert_sorted(items.begin(), items.end());
+  }
+  flat_set(const flat_set &other) : keys_(other.keys_), comp_(other.comp_) {}
+  flat_set(flat_set &&other) : comp_(other.comp_) { swap(other); }
+
+  // Builds from a range sorted by comp in O(n); see insert_sorted.
+  template <typename InputIt>
+  static flat_set from_sorted(InputIt first, InputIt last,
+                              const Compare &comp = Compare()) {
+    flat_set result(comp);
+    result.insert_sorted(first, last);
+    return result;
+  }
+
+  // DESTRUCTOR
+  ~flat_set() = default;
+
+  // OVERLOAD OPERATORS
+  flat_set &operator=(const flat_set &other) {
+    flat_set copy(other);
+    swap(copy);
+    return *this;
+  }
+  flat_set &operator=(flat_set &&other) {
+    swap(other);
+    return *this;
+  }
+
+  // MAIN FUNCTIONS
+  bool empty() const { return keys_.empty(); }
+  size_type size() const { return keys_.size(); }
+  size_type max_size() const {
+    return std::numeric_limits<std::ptrdiff_t>::max() / sizeof(key_type);
+  }
+  key_compare key_comp() const { return comp_; }
+  key_compare value_comp() const { return comp_; }
+  void swap(flat_set &other) {
+    keys_.swap(other.keys_);
+    std::swap(comp_, other.comp_);
+  }
+  void clear() { Vector<key_type>().swap(keys_); }
+
+  iterator find(const value_type &key) const { return begin() + indexOf(key); }
+  template <typename L, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const L &key) const {
+    return begin() + indexOf(key);
+  }
+  bool contains(const value_type &key) const { return indexOf(key) != size(); }
+  template <typename L, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const L &key) const {
+    return indexOf(key) != size();
+  }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return insertUnique(value);
+  }
+  std::pair<iterator, bool> insert(value_type &&value) {
+    return insertUnique(std::move(value));
+  }
+  // Builds the key first, since it is needed to find its slot.
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    return insertUnique(value_type(std::forward<Args>(args)...));
+  }
+
+  // RANGE LOOKUP
+  iterator lower_bound(const key_type &key) const {
+    return begin() + lowerIndex(key);
+  }
+  template <typename L, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator lower_bound(const L &key) const {
+    return begin() + lowerIndex(key);
+  }
+  iterator upper_bound(const key_type &key) const {
+    return begin() + upperIndex(key);
+  }
+  template <typename L, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator upper_bound(const L &key) const {
+    return begin() + upperIndex(key);
+  }
+  std::pair<iterator, iterator> equal_range(const key_type &key) const {
+    return equalIndices(key);
+  }
+  template <typename L, typename C = Compare,
+            typename = typename C::is_transparent>
+  std::pair<iterator, iterator> equal_range(const L &key) const {
+    return equalIndices(key);
+  }
+
+  // Merges a sorted batch in O(n + m), keeping the first of equivalent
+  // elements like insert does. An unsorted batch is inserted one element
+  // at a time.
+  template <typename InputIt>
+  void insert_sorted(InputIt first, InputIt last) {
+    Vector<key_type> keys;
+    for (; first != last; ++first) {
+      if (!keys.empty()) {
+        const key_type &prev = keys.data()[keys.size() - 1];
+        if (!comp_(prev, *first)) {
+          if (comp_(*first, prev)) break;
+          continue;
+        }
+      }
+      flatGrow(keys);
+      keys.push_back(*first);
+    }
+    mergeSorted(keys);
+    for (; first != last; ++first) insert(*first);
+  }
+  void erase(iterator pos) {
+    size_type first = pos - begin();
+    eraseIndices(first, first + 1);
+  }
+  // Removes the keys in [lo, hi) with one shift of the tail and returns
+  // how many were removed.
+  size_type erase_range(const key_type &lo, const key_type &hi) {
+    if (!comp_(lo, hi)) return 0;
+    size_type first = lowerIndex(lo);
+    size_type last = lowerIndex(hi);
+    eraseIndices(first, last);
+    return last - first;
+  }
+  // Moves over the keys of other that are missing here; the rest stay
+  // in other.
+  void merge(flat_set &other) {
+    if (&other == this) return;
+    Vector<key_type> moved;
+    flat_set rest(other.comp_);
+    for (size_type i = 0; i < other.size(); ++i) {
+      key_type &key = other.keys_.data()[i];
+      Vector<key_type> &target = contains(key) ? rest.keys_ : moved;
+      flatGrow(target);
+      target.push_back(std::move(key));
+    }
+    mergeSorted(moved);
+    other.swap(rest);
+  }
+
+  // ITERATORS FUNCTIONS
+  iterator begin() const { return keys_.data(); }
+  iterator end() const { return keys_.data() + size(); }
+
+ private:
+  template <typename L>
+  size_type lowerIndex(const L &key) const {
+    return branchlessLowerBound(keys_.data(), size(), key, comp_);
+  }
+  template <typename L>
+  size_type upperIndex(const L &key) const {
+    return branchlessUpperBound(keys_.data(), size(), key, comp_);
+  }
+  template <typename L>
+  size_type indexOf(const L &key) const {
+    size_type pos = lowerIndex(key);
+    return pos != size() && !comp_(key, keys_.data()[pos]) ? pos : size();
+  }
+  template <typename L>
+  std::pair<iterator, iterator> equalIndices(const L &key) const {
+    size_type pos = lowerIndex(key);
+    size_type last = pos + (pos != size() && !comp_(key, keys_.data()[pos]));
+    return std::make_pair(begin() + pos, begin() + last);
+  }
+
+  template <typename Value>
+  std::pair<iterator, bool> insertUnique(Value &&value) {
+    size_type pos = lowerIndex(value);
+    if (pos != size() && !comp_(value, keys_.data()[pos]))
+      return std::make_pair(begin() + pos, false);
+    flatGrow(keys_);
+    keys_.push_back(std::forward<Value>(value));
+    std::rotate(keys_.data() + pos, keys_.data() + size() - 1,
+                keys_.data() + size());
+    return std::make_pair(begin() + pos, true);
+  }
+
+  void eraseIndices(size_type first, size_type last) {
+    if (first >= last) return;
+    size_type count = size();
+    std::move(keys_.data() + last, keys_.data() + count, keys_.data() + first);
+    for (size_type i = first + count - last; i < count; ++i) {
+      keys_.data()[i] = key_type();
+      keys_.pop_back();
+    }
+  }
+  void mergeSorted(Vector<key_type> &keys) {
+    flatMergeSorted<key_type, flatNoValues>(keys_, nullptr, keys, nullptr,
+                                            comp_);
+  }
+
+  Vector<key_type> keys_;
+  Compare comp_;
+};
+}  // namespace s21
+#endif  // CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_FLAT_SET_H_
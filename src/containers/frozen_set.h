@@ -0,0 +1,209 @@
+#ifndef CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_FROZEN_SET_H_
+#define CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_FROZEN_SET_H_
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+
+#include "vector.h"
+
+namespace s21 {
+// Immutable search index in Eytzinger order: the element at slot k has
+// its children at 2k and 2k + 1, so the top levels of every search share
+// the same few cache lines and the slots a search will touch a few
+// levels down can be prefetched before they are needed. Built from a
+// sorted range, usually by set::freeze().
+template <typename T, typename Compare = std::less<T>>
+class frozen_set {
+ public:
+  using key_type = T;
+  using value_type = T;
+  using reference = const T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+  using key_compare = Compare;
+
+  // Walks the slots in sorted order; slot 0 is the past-the-end position.
+  class frozenIterator {
+   public:
+    /* ----- TYPES ----- */
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T *;
+    using reference = const T &;
+
+    frozenIterator() : data_(nullptr), index_(0), size_(0){};
+    frozenIterator(const T *data, size_type index, size_type size)
+        : data_(data), index_(index), size_(size){};
+
+    frozenIterator &operator++() {
+      if (2 * index_ + 1 <= size_) {
+        index_ = descend(2 * index_ + 1, 0);
+      } else {
+        while (index_ & 1) index_ >>= 1;
+        index_ >>= 1;
+      }
+      return *this;
+    }
+    frozenIterator &operator--() {
+      if (!index_) {
+        index_ = size_ ? descend(1, 1) : 0;
+      } else if (2 * index_ <= size_) {
+        index_ = descend(2 * index_, 1);
+      } else {
+        while (!(index_ & 1)) index_ >>= 1;
+        index_ >>= 1;
+      }
+      return *this;
+    }
+    frozenIterator operator++(int) {
+      frozenIterator ret_it(*this);
+      ++(*this);
+      return ret_it;
+    }
+    frozenIterator operator--(int) {
+      frozenIterator ret_it(*this);
+      --(*this);
+      return ret_it;
+    }
+
+    bool operator==(const frozenIterator &other) const {
+      return index_ == other.index_;
+    }
+    bool operator!=(const frozenIterator &other) const {
+      return index_ != other.index_;
+    }
+
+    reference operator*() const { return data_[index_]; }
+    pointer operator->() const { return data_ + index_; }
+
+   private:
+    friend class frozen_set;
+
+    // Follows left (right = 0) or right (right = 1) children from k.
+    size_type descend(size_type k, size_type right) const {
+      while (2 * k + right <= size_) k = 2 * k + right;
+      return k;
+    }
+
+    const T *data_;
+    size_type index_;
+    size_type size_;
+  };
+
+  using iterator = frozenIterator;
+  using const_iterator = frozenIterator;
+
+  // CONSTRUCTORS
+  frozen_set() = default;
+  explicit frozen_set(const Compare &comp) : comp_(comp) {}
+  frozen_set(const frozen_set &other)
+      : slots_(other.slots_), comp_(other.comp_) {}
+  frozen_set(frozen_set &&other) : comp_(other.comp_) { swap(other); }
+
+  // Builds from a strictly increasing range of known length in O(n).
+  template <typename InputIt>
+  static frozen_set from_sorted(InputIt first, size_type count,
+                                const Compare &comp = Compare()) {
+    frozen_set result(comp);
+    result.slots_.reserve(count + 1);
+    for (size_type i = 0; i <= count; ++i) result.slots_.push_back(T());
+    for (iterator it = result.begin(); it != result.end(); ++it, ++first)
+      result.slots_.data()[it.index_] = *first;
+    return result;
+  }
+
+  // DESTRUCTOR
+  ~frozen_set() = default;
+
+  // OVERLOAD OPERATORS
+  frozen_set &operator=(const frozen_set &other) {
+    frozen_set copy(other);
+    swap(copy);
+    return *this;
+  }
+  frozen_set &operator=(frozen_set &&other) {
+    swap(other);
+    return *this;
+  }
+
+  // MAIN FUNCTIONS
+  bool empty() const { return !size(); }
+  size_type size() const { return slots_.empty() ? 0 : slots_.size() - 1; }
+  key_compare key_comp() const { return comp_; }
+  void swap(frozen_set &other) {
+    slots_.swap(other.slots_);
+    std::swap(comp_, other.comp_);
+  }
+
+  bool contains(const key_type &key) const { return find(key) != end(); }
+  iterator find(const key_type &key) const {
+    size_type k = lowerSlot(key);
+    return k && !comp_(key, slots_.data()[k]) ? toIterator(k) : end();
+  }
+  iterator lower_bound(const key_type &key) const {
+    return toIterator(lowerSlot(key));
+  }
+  iterator upper_bound(const key_type &key) const {
+    return toIterator(upperSlot(key));
+  }
+
+  // ITERATORS FUNCTIONS
+  iterator begin() const { return ++toIterator(0); }
+  iterator end() const { return toIterator(0); }
+
+ private:
+  // Slot k * stride starts the run of k's descendants that fills one
+  // cache line, four levels down for 4-byte keys.
+  static constexpr size_type kPrefetchStride =
+      sizeof(T) < 64 ? 64 / sizeof(T) : 1;
+
+  iterator toIterator(size_type k) const {
+    return iterator(slots_.data(), k, size());
+  }
+  void prefetch(size_type k) const {
+#if defined(__GNUC__)
+    if (k * kPrefetchStride < slots_.size())
+      __builtin_prefetch(slots_.data() + k * kPrefetchStride);
+#else
+    (void)k;
+#endif
+  }
+  // Each step goes left or right by comparison result alone; the path
+  // is then unwound past the trailing right turns to the last left turn,
+  // which is the answer (0 when every key compared less).
+  size_type lowerSlot(const key_type &key) const {
+    size_type n = size();
+    size_type k = 1;
+    while (k <= n) {
+      prefetch(k);
+      k = 2 * k + (comp_(slots_.data()[k], key) ? 1 : 0);
+    }
+    return k >> (trailingOnes(k) + 1);
+  }
+  size_type upperSlot(const key_type &key) const {
+    size_type n = size();
+    size_type k = 1;
+    while (k <= n) {
+      prefetch(k);
+      k = 2 * k + (comp_(key, slots_.data()[k]) ? 0 : 1);
+    }
+    return k >> (trailingOnes(k) + 1);
+  }
+  static size_type trailingOnes(size_type k) {
+#if defined(__GNUC__)
+    return __builtin_ctzll(~static_cast<unsigned long long>(k));
+#else
+    size_type count = 0;
+    for (; k & 1; k >>= 1) ++count;
+    return count;
+#endif
+  }
+
+  Vector<T> slots_;
+  Compare comp_;
+};
+}  // namespace s21
+#endif  // CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_FROZEN_SET_H_
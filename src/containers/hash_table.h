@@ -0,0 +1,397 @@
+#ifndef CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_HASH_TABLE_H_
+#define CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_HASH_TABLE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+template <typename K, typename V>
+struct hashEntry {
+  template <typename... Args>
+  explicit hashEntry(const K &key, Args &&...args)
+      : key_(key), value_(std::forward<Args>(args)...) {}
+
+  K key_;
+  V value_;
+};
+template <typename K>
+struct hashEntry<K, void> {
+  explicit hashEntry(const K &key) : key_(key) {}
+
+  K key_;
+};
+
+// Element view with the same key_/value_ members as a map node.
+template <typename K, typename V>
+struct hashReference {
+  const K &key_;
+  V &value_;
+
+  const hashReference *operator->() const { return this; }
+};
+
+// Open-addressing table with robin hood probing. Entries sit inline in
+// one array and a parallel byte array holds each slot's distance from
+// its home slot plus one (0 marks an empty slot). An insert takes the
+// first slot whose entry sits closer to home than the new key would and
+// shifts the rest of that run along, which keeps probe sequences short
+// and lets a miss stop at the first entry closer to home than the probe.
+// Erase shifts the following entries back instead of leaving tombstones.
+// Both arrays come from Allocator, rebound to the entry and byte types.
+template <typename K, typename V, typename Hash = std::hash<K>,
+          typename KeyEqual = std::equal_to<K>,
+          typename Allocator = std::allocator<hashEntry<K, V>>>
+class HashTable {
+ public:
+  using key_type = K;
+  using mapped_type = V;
+  using size_type = size_t;
+  using entry = hashEntry<K, V>;
+  using allocator_type = Allocator;
+  using entry_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<entry>;
+  using entry_traits = std::allocator_traits<entry_allocator>;
+  using byte_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<uint8_t>;
+  using byte_traits = std::allocator_traits<byte_allocator>;
+
+  // Inserts, erases and rehashes shift entries within and between the
+  // arrays; a move that threw halfway would leave slots marked live that
+  // hold no entry.
+  static_assert(std::is_nothrow_move_constructible<entry>::value &&
+                    std::is_nothrow_move_assignable<entry>::value,
+                "HashTable needs keys and values that move without throwing");
+
+  static constexpr size_type kMinCapacity = 16;
+  static constexpr size_type npos = static_cast<size_type>(-1);
+
+  // M is the mapped type as seen through the iterator, or void to walk
+  // the keys only.
+  template <typename M>
+  class hashIterator {
+   public:
+    /* ----- TYPES ----- */
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::conditional_t<std::is_void<M>::value, const K &,
+                                         hashReference<K, M>>;
+    using pointer = std::conditional_t<std::is_void<M>::value, const K *,
+                                       hashReference<K, M>>;
+    using value_type = std::conditional_t<std::is_void<M>::value, K,
+                                          hashReference<K, M>>;
+
+    hashIterator() : table_(nullptr), index_(0){};
+    hashIterator(const HashTable *table, size_type index)
+        : table_(table), index_(index){};
+    template <typename N, typename = std::enable_if_t<
+                              std::is_same<const N, M>::value &&
+                              !std::is_same<N, M>::value>>
+    hashIterator(const hashIterator<N> &other)
+        : table_(other.table_), index_(other.index_) {}
+
+    hashIterator &operator++() {
+      index_ = table_->nextOccupied(index_ + 1);
+      return *this;
+    }
+    hashIterator operator++(int) {
+      hashIterator ret_it(*this);
+      ++(*this);
+      return ret_it;
+    }
+
+    bool operator==(const hashIterator &other) const {
+      return index_ == other.index_;
+    }
+    bool operator!=(const hashIterator &other) const {
+      return index_ != other.index_;
+    }
+
+    reference operator*() const {
+      entry &cur = table_->slots_[index_];
+      if constexpr (std::is_void<M>::value) {
+        return cur.key_;
+      } else {
+        return reference{cur.key_, cur.value_};
+      }
+    }
+    pointer operator->() const {
+      if constexpr (std::is_void<M>::value) {
+        return &table_->slots_[index_].key_;
+      } else {
+        return **this;
+      }
+    }
+
+   private:
+    template <typename>
+    friend class hashIterator;
+    friend class HashTable;
+
+    const HashTable *table_;
+    size_type index_;
+  };
+
+  // CONSTRUCTORS
+  HashTable() = default;
+  explicit HashTable(const Hash &hash, const KeyEqual &equal = KeyEqual(),
+                     const Allocator &alloc = Allocator())
+      : alloc_(alloc), hash_(hash), equal_(equal) {}
+  // Copies slot by slot: with the same capacity every entry hashes to
+  // the same home, so the layout carries over as is.
+  HashTable(const HashTable &other)
+      : alloc_(entry_traits::select_on_container_copy_construction(
+            other.alloc_)),
+        hash_(other.hash_),
+        equal_(other.equal_) {
+    if (!other.capacity_) return;
+    allocate(other.capacity_);
+    try {
+      for (size_type i = 0; i < capacity_; ++i) {
+        if (!other.dist_[i]) continue;
+        new (slots_ + i) entry(other.slots_[i]);
+        dist_[i] = other.dist_[i];
+      }
+    } catch (...) {
+      destroyAll();
+      throw;
+    }
+    count_ = other.count_;
+  }
+  HashTable(HashTable &&other)
+      : alloc_(other.alloc_), hash_(other.hash_), equal_(other.equal_) {
+    swap(other);
+  }
+
+  // DESTRUCTOR
+  ~HashTable() { destroyAll(); }
+
+  // OVERLOAD OPERATORS
+  HashTable &operator=(const HashTable &other) {
+    if (this != &other) {
+      HashTable copy(other);
+      swap(copy);
+    }
+    return *this;
+  }
+  HashTable &operator=(HashTable &&other) {
+    if (this != &other) {
+      clear();
+      swap(other);
+    }
+    return *this;
+  }
+
+  // MAIN FUNCTIONS
+  size_type size() const { return count_; }
+  size_type capacity() const { return capacity_; }
+  Hash hash_function() const { return hash_; }
+  allocator_type get_allocator() const { return allocator_type(alloc_); }
+  KeyEqual key_eq() const { return equal_; }
+
+  template <typename M>
+  hashIterator<M> begin() const {
+    return hashIterator<M>(this, nextOccupied(0));
+  }
+  template <typename M>
+  hashIterator<M> end() const {
+    return hashIterator<M>(this, capacity_);
+  }
+  template <typename M>
+  hashIterator<M> find(const K &key) const {
+    size_type pos = findIndex(key);
+    return hashIterator<M>(this, pos == npos ? capacity_ : pos);
+  }
+
+  // Inserts key with a value built from args unless the key is present.
+  template <typename... Args>
+  std::pair<hashIterator<V>, bool> insertUnique(const K &key,
+                                                Args &&...args) {
+    size_type pos = findIndex(key);
+    if (pos != npos) return std::make_pair(hashIterator<V>(this, pos), false);
+    entry cur(key, std::forward<Args>(args)...);
+    if ((count_ + 1) * 8 > capacity_ * 7) {
+      rehash(capacity_ ? capacity_ * 2 : kMinCapacity);
+    }
+    uint8_t dist;
+    while ((pos = openSlot(cur.key_, dist)) == npos) {
+      // Growing only helps if the keys are spread out; a hash that sends
+      // this many keys to one slot would make the table grow forever.
+      if (count_ * 2 < capacity_) {
+        throw std::length_error("Hash table probe sequence too long");
+      }
+      rehash(capacity_ * 2);
+    }
+    new (slots_ + pos) entry(std::move(cur));
+    dist_[pos] = dist;
+    ++count_;
+    return std::make_pair(hashIterator<V>(this, pos), true);
+  }
+
+  size_type erase(const K &key) {
+    size_type pos = findIndex(key);
+    if (pos == npos) return 0;
+    eraseAt(pos);
+    return 1;
+  }
+  template <typename M>
+  void erase(hashIterator<M> pos) {
+    eraseAt(pos.index_);
+  }
+
+  // Grows to fit count entries without rehashing.
+  void reserve(size_type count) {
+    size_type capacity = kMinCapacity;
+    while (capacity * 7 < count * 8) capacity *= 2;
+    if (capacity > capacity_) rehash(capacity);
+  }
+  void clear() {
+    destroyAll();
+    slots_ = nullptr;
+    dist_ = nullptr;
+    capacity_ = count_ = 0;
+  }
+  void swap(HashTable &other) {
+    std::swap(alloc_, other.alloc_);
+    std::swap(slots_, other.slots_);
+    std::swap(dist_, other.dist_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(count_, other.count_);
+    std::swap(shift_, other.shift_);
+    std::swap(hash_, other.hash_);
+    std::swap(equal_, other.equal_);
+  }
+
+ private:
+  // Distances are kept in a byte; a probe this long forces a rehash.
+  static constexpr uint8_t kMaxDistance = 255;
+
+  // Fibonacci hashing: spreads weak hashes such as the identity hash of
+  // std::hash<int> over the top bits before they pick a slot.
+  size_type homeOf(const K &key) const {
+    uint64_t mixed =
+        static_cast<uint64_t>(hash_(key)) * 0x9E3779B97F4A7C15ull;
+    return static_cast<size_type>(mixed >> shift_);
+  }
+  size_type nextOccupied(size_type pos) const {
+    while (pos < capacity_ && !dist_[pos]) ++pos;
+    return pos;
+  }
+  size_type findIndex(const K &key) const {
+    if (!count_) return npos;
+    size_type mask = capacity_ - 1;
+    size_type pos = homeOf(key);
+    for (uint8_t dist = 1; dist_[pos] >= dist; ++dist) {
+      if (equal_(slots_[pos].key_, key)) return pos;
+      pos = (pos + 1) & mask;
+    }
+    return npos;
+  }
+
+  // Finds the slot key belongs in, the first one holding an entry closer
+  // to its home, and frees it by shifting the rest of the run one slot
+  // on. Returns npos with the table untouched when a distance would
+  // overflow its byte.
+  size_type openSlot(const K &key, uint8_t &dist) {
+    size_type mask = capacity_ - 1;
+    size_type pos = homeOf(key);
+    for (dist = 1; dist_[pos] >= dist; ++dist) pos = (pos + 1) & mask;
+    if (dist == kMaxDistance) return npos;
+    size_type last = pos;
+    for (; dist_[last]; last = (last + 1) & mask) {
+      if (dist_[last] == kMaxDistance - 1) return npos;
+    }
+    while (last != pos) {
+      size_type prev = (last - 1) & mask;
+      new (slots_ + last) entry(std::move(slots_[prev]));
+      slots_[prev].~entry();
+      dist_[last] = dist_[prev] + 1;
+      last = prev;
+    }
+    return pos;
+  }
+
+  void eraseAt(size_type pos) {
+    size_type mask = capacity_ - 1;
+    size_type next = (pos + 1) & mask;
+    while (dist_[next] > 1) {
+      slots_[pos] = std::move(slots_[next]);
+      dist_[pos] = dist_[next] - 1;
+      pos = next;
+      next = (next + 1) & mask;
+    }
+    slots_[pos].~entry();
+    dist_[pos] = 0;
+    --count_;
+  }
+
+  // Doubling maps home h to 2h or 2h + 1, so no entry ends up further
+  // from home than before and openSlot cannot fail here.
+  void rehash(size_type capacity) {
+    entry *old_slots = slots_;
+    uint8_t *old_dist = dist_;
+    size_type old_capacity = capacity_;
+    allocate(capacity);
+    for (size_type i = 0; i < old_capacity; ++i) {
+      if (!old_dist[i]) continue;
+      uint8_t dist;
+      size_type pos = openSlot(old_slots[i].key_, dist);
+      new (slots_ + pos) entry(std::move(old_slots[i]));
+      dist_[pos] = dist;
+      old_slots[i].~entry();
+    }
+    if (old_slots) {
+      entry_traits::deallocate(alloc_, old_slots, old_capacity);
+      byte_allocator bytes(alloc_);
+      byte_traits::deallocate(bytes, old_dist, old_capacity);
+    }
+  }
+
+  // Both arrays are built before any member changes, so a failed
+  // allocation leaves the table (and rehash's old arrays) untouched.
+  void allocate(size_type capacity) {
+    byte_allocator bytes(alloc_);
+    uint8_t *dist = byte_traits::allocate(bytes, capacity);
+    entry *slots;
+    try {
+      slots = entry_traits::allocate(alloc_, capacity);
+    } catch (...) {
+      byte_traits::deallocate(bytes, dist, capacity);
+      throw;
+    }
+    std::fill(dist, dist + capacity, uint8_t(0));
+    dist_ = dist;
+    slots_ = slots;
+    capacity_ = capacity;
+    shift_ = 64;
+    for (size_type i = capacity; i > 1; i >>= 1) --shift_;
+  }
+  void destroyAll() {
+    for (size_type i = 0; i < capacity_; ++i) {
+      if (dist_[i]) slots_[i].~entry();
+    }
+    if (slots_) {
+      entry_traits::deallocate(alloc_, slots_, capacity_);
+      byte_allocator bytes(alloc_);
+      byte_traits::deallocate(bytes, dist_, capacity_);
+    }
+  }
+
+  entry *slots_ = nullptr;
+  uint8_t *dist_ = nullptr;
+  size_type capacity_ = 0;
+  size_type count_ = 0;
+  unsigned shift_ = 64;
+  entry_allocator alloc_;
+  Hash hash_;
+  KeyEqual equal_;
+};
+}  // namespace s21
+#endif  // CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_HASH_TABLE_H_
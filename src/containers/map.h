@@ -4,30 +4,49 @@
 #include "tree.h"
 
 namespace s21 {
-template <typename K, typename V>
+template <typename K, typename V, typename Compare = std::less<K>,
+          typename Allocator = std::allocator<std::pair<const K, V>>,
+          bool Ranked = false>
 class map {
  public:
-  using tree = Tree<K, V>;
+  using tree = Tree<K, V, Compare, Allocator, Ranked>;
   using key_type = K;
   using mapped_type = V;
+  using key_compare = Compare;
+  using allocator_type = Allocator;
   using value_type = std::pair<const key_type, mapped_type>;
   using reference = value_type &;
   using const_reference = const value_type &;
   using iterator = typename tree::iterator;
   using const_iterator = typename tree::const_iterator;
   using size_type = size_t;
+  using node_type = typename tree::node_type;
+  using insert_return_type = treeInsertReturn<iterator, node_type>;
 
   // CONSTRUCTORS
   map() = default;
-  map(std::initializer_list<value_type> const &items) {
-    for (auto i = items.begin(); i != items.end(); ++i)
-      if (!tree_.findNode(i->first)) tree_.insert(i->first, i->second);
+  explicit map(const Compare &comp, const Allocator &alloc = Allocator())
+      : tree_(comp, alloc) {}
+  map(std::initializer_list<value_type> const &items,
+      const Compare &comp = Compare(), const Allocator &alloc = Allocator())
+      : tree_(comp, alloc) {
+    tree_.insertSorted(items.begin(), items.end());
   }
 
   map(const map &other) : tree_(other.tree_){};
 
   map(map &&other) : tree_(std::move(other.tree_)) {}
 
+  // Builds from a range sorted by comp in O(n); see insert_sorted.
+  template <typename InputIt>
+  static map from_sorted(InputIt first, InputIt last,
+                         const Compare &comp = Compare(),
+                         const Allocator &alloc = Allocator()) {
+    map result(comp, alloc);
+    result.insert_sorted(first, last);
+    return result;
+  }
+
   // DESTRUCTOR
   ~map() = default;
 
@@ -42,13 +61,22 @@ class map {
     return *this;
   }
   mapped_type &operator[](const key_type &key) {
-    if (!tree_.findNode(key)) tree_.insert(key, mapped_type());
-    return tree_.findNode(key)->value_;
+    return tree_.insertUnique(key).first->value_;
+  }
+  mapped_type &operator[](key_type &&key) {
+    return tree_.insertUnique(std::move(key)).first->value_;
   }
 
   mapped_type &at(const key_type &key) {
     auto res = tree_.findNode(key);
-    if (!res) std::out_of_range("Key does not exist");
+    if (!res) throw std::out_of_range("Key does not exist");
+    return res->value_;
+  }
+  template <typename L, typename C = Compare,
+            typename = typename C::is_transparent>
+  mapped_type &at(const L &key) {
+    auto res = tree_.findNode(key);
+    if (!res) throw std::out_of_range("Key does not exist");
     return res->value_;
   }
 
@@ -60,63 +88,196 @@ class map {
 
   // MAIN FUNCTIONS
   bool empty() const { return !tree_.count_; }
-  iterator find(const key_type &key) const {
-    return iterator(tree_.findNode(key));
+  iterator find(const key_type &key) {
+    auto res = tree_.findNode(key);
+    return res ? iterator(res) : end();
+  }
+  const_iterator find(const key_type &key) const {
+    auto res = tree_.findNode(key);
+    return res ? const_iterator(res) : end();
+  }
+  template <typename L, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const L &key) {
+    auto res = tree_.findNode(key);
+    return res ? iterator(res) : end();
+  }
+  template <typename L, typename C = Compare,
+            typename = typename C::is_transparent>
+  const_iterator find(const L &key) const {
+    auto res = tree_.findNode(key);
+    return res ? const_iterator(res) : end();
   }
   bool contains(const key_type &key) const {
     return (tree_.findNode(key)) ? true : false;
   }
+  template <typename L, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const L &key) const {
+    return (tree_.findNode(key)) ? true : false;
+  }
   void swap(map &other) { tree_ = std::move(other.tree_); }
 
   size_type size() const { return tree_.count_; }
   size_type max_size() const { return size_type(-1); }
+  key_compare key_comp() const { return tree_.key_comp(); }
 
   std::pair<iterator, bool> insert(const value_type &value) {
-    bool exist = tree_.findNode(value.first);
-    if (!exist) tree_.insert(value.first, value.second);
-    iterator pos(tree_.findNode(value.first));
-    return std::make_pair(pos, !exist);
+    auto res = tree_.insertUnique(value.first, value.second);
+    return std::make_pair(iterator(res.first), res.second);
+  }
+  std::pair<iterator, bool> insert(value_type &&value) {
+    auto res = tree_.insertUnique(value.first, std::move(value.second));
+    return std::make_pair(iterator(res.first), res.second);
   }
   std::pair<iterator, bool> insert(const key_type &key,
                                    const mapped_type &obj) {
-    bool exist = tree_.findNode(key);
-    if (!exist) tree_.insert(key, obj);
-    iterator pos(tree_.findNode(key));
-    return std::make_pair(pos, !exist);
+    auto res = tree_.insertUnique(key, obj);
+    return std::make_pair(iterator(res.first), res.second);
+  }
+  std::pair<iterator, bool> insert(key_type &&key, mapped_type &&obj) {
+    auto res = tree_.insertUnique(std::move(key), std::move(obj));
+    return std::make_pair(iterator(res.first), res.second);
   }
   std::pair<iterator, bool> insert_or_assign(const key_type &key,
                                              const mapped_type &obj) {
-    bool exist = tree_.findNode(key);
-    if (!exist) {
-      tree_.insert(key, obj);
-    } else {
-      tree_.findNode(key)->value_ = obj;
-    }
-    iterator pos(tree_.findNode(key));
-    return std::make_pair(pos, !exist);
+    auto res = tree_.insertUnique(key, obj);
+    if (!res.second) res.first->value_ = obj;
+    return std::make_pair(iterator(res.first), res.second);
+  }
+  std::pair<iterator, bool> insert_or_assign(key_type &&key,
+                                             mapped_type &&obj) {
+    auto res = tree_.insertUnique(std::move(key), std::move(obj));
+    if (!res.second) res.first->value_ = std::move(obj);
+    return std::make_pair(iterator(res.first), res.second);
+  }
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    auto res = tree_.emplaceUnique(std::forward<Args>(args)...);
+    return std::make_pair(iterator(res.first), res.second);
+  }
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const key_type &key, Args &&...args) {
+    auto res = tree_.insertUnique(key, std::forward<Args>(args)...);
+    return std::make_pair(iterator(res.first), res.second);
+  }
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(key_type &&key, Args &&...args) {
+    auto res = tree_.insertUnique(std::move(key), std::forward<Args>(args)...);
+    return std::make_pair(iterator(res.first), res.second);
   }
 
-  void erase(iterator pos) {
-    if (pos != end())
-      tree_.remove(pos->key_);
-    else if (pos == end() and pos != nullptr)
-      tree_.remove(pos->key_);
+  // NODE HANDLES
+  node_type extract(iterator pos) { return tree_.extract(pos); }
+  node_type extract(const key_type &key) {
+    auto res = tree_.findNode(key);
+    return res ? tree_.extract(iterator(res)) : node_type();
   }
-  void merge(map &other) {
-    for (auto it = other.begin(), et = other.end(); it != et; ++it)
-      insert(it->key_, it->value_);
-    if (other.end() != nullptr) insert(other.end()->key_, other.end()->value_);
-    other.clear();
+  insert_return_type insert(node_type &&handle) {
+    if (handle.empty()) return {end(), false, node_type()};
+    auto res = tree_.insertHandle(handle);
+    return {iterator(res.first), res.second, std::move(handle)};
   }
 
-  void clear() {
-    if (tree_.root_) delete tree_.root_;
-    tree_.root_ = nullptr;
-    tree_.count_ = 0;
+  // RANGE LOOKUP
+  iterator lower_bound(const key_type &key) {
+    return iterator(tree_.lowerBound(key));
+  }
+  const_iterator lower_bound(const key_type &key) const {
+    return const_iterator(tree_.lowerBound(key));
+  }
+  template <typename L, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator lower_bound(const L &key) {
+    return iterator(tree_.lowerBound(key));
+  }
+  template <typename L, typename C = Compare,
+            typename = typename C::is_transparent>
+  const_iterator lower_bound(const L &key) const {
+    return const_iterator(tree_.lowerBound(key));
+  }
+  iterator upper_bound(const key_type &key) {
+    return iterator(tree_.upperBound(key));
+  }
+  const_iterator upper_bound(const key_type &key) const {
+    return const_iterator(tree_.upperBound(key));
+  }
+  template <typename L, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator upper_bound(const L &key) {
+    return iterator(tree_.upperBound(key));
+  }
+  template <typename L, typename C = Compare,
+            typename = typename C::is_transparent>
+  const_iterator upper_bound(const L &key) const {
+    return const_iterator(tree_.upperBound(key));
+  }
+  std::pair<iterator, iterator> equal_range(const key_type &key) {
+    auto res = tree_.equalRange(key);
+    return std::make_pair(iterator(res.first), iterator(res.second));
+  }
+  std::pair<const_iterator, const_iterator> equal_range(
+      const key_type &key) const {
+    auto res = tree_.equalRange(key);
+    return std::make_pair(const_iterator(res.first),
+                          const_iterator(res.second));
+  }
+  template <typename L, typename C = Compare,
+            typename = typename C::is_transparent>
+  std::pair<iterator, iterator> equal_range(const L &key) {
+    auto res = tree_.equalRange(key);
+    return std::make_pair(iterator(res.first), iterator(res.second));
+  }
+  template <typename L, typename C = Compare,
+            typename = typename C::is_transparent>
+  std::pair<const_iterator, const_iterator> equal_range(const L &key) const {
+    auto res = tree_.equalRange(key);
+    return std::make_pair(const_iterator(res.first),
+                          const_iterator(res.second));
   }
 
+  // ORDER STATISTICS
+  // Only available when Ranked is set; each query is O(log n).
+  iterator nth_element(size_type k) {
+    auto res = tree_.selectNode(k);
+    return res ? iterator(res) : end();
+  }
+  const_iterator nth_element(size_type k) const {
+    auto res = tree_.selectNode(k);
+    return res ? const_iterator(res) : end();
+  }
+  size_type rank(const key_type &key) const { return tree_.rank(key); }
+  size_type count_range(const key_type &lo, const key_type &hi) const {
+    return tree_.countRange(lo, hi);
+  }
+
+  // Linear when the container is empty and the range is sorted; keeps
+  // the first of equivalent elements like insert does.
+  template <typename InputIt>
+  void insert_sorted(InputIt first, InputIt last) {
+    tree_.insertSorted(first, last);
+  }
+  void erase(iterator pos) { tree_.erase(pos); }
+  iterator erase(iterator first, iterator last) {
+    tree_.erase(first, last);
+    return last;
+  }
+  // Removes the keys in [lo, hi) in O(k + log n) and returns k.
+  size_type erase_range(const key_type &lo, const key_type &hi) {
+    if (!key_comp()(lo, hi)) return 0;
+    return tree_.erase(lower_bound(lo), lower_bound(hi));
+  }
+  void merge(map &other) { tree_.merge(other.tree_); }
+
+  void clear() { tree_.clear(); }
+
  private:
   tree tree_;
 };
+
+// map that also answers rank and select queries in O(log n).
+template <typename K, typename V, typename Compare = std::less<K>,
+          typename Allocator = std::allocator<std::pair<const K, V>>>
+using ranked_map = map<K, V, Compare, Allocator, true>;
 }  // namespace s21
 #endif  // CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_MAP_H_
\ No newline at end of file
@@ -0,0 +1,137 @@
+#ifndef CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_MULTIMAP_H_
+#define CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_MULTIMAP_H_
+
+#include "tree.h"
+
+namespace s21 {
+// map that keeps every inserted entry. Each entry is its own node, and
+// entries with equivalent keys sit next to each other in insertion
+// order.
+template <typename K, typename V, typename Compare = std::less<K>,
+          typename Allocator = std::allocator<std::pair<const K, V>>>
+class multimap {
+ public:
+  using tree = Tree<K, V, Compare, Allocator>;
+  using key_type = K;
+  using mapped_type = V;
+  using key_compare = Compare;
+  using allocator_type = Allocator;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = typename tree::iterator;
+  using const_iterator = typename tree::const_iterator;
+  using size_type = size_t;
+
+  // CONSTRUCTORS
+  multimap() = default;
+  explicit multimap(const Compare &comp, const Allocator &alloc = Allocator())
+      : tree_(comp, alloc) {}
+  multimap(std::initializer_list<value_type> const &items,
+           const Compare &comp = Compare(),
+           const Allocator &alloc = Allocator())
+      : tree_(comp, alloc) {
+    for (const value_type &item : items) insert(item);
+  }
+  multimap(const multimap &other) : tree_(other.tree_) {}
+  multimap(multimap &&other) : tree_(std::move(other.tree_)) {}
+
+  // DESTRUCTOR
+  ~multimap() = default;
+
+  // OVERLOAD OPERATORS
+  multimap &operator=(const multimap &other) {
+    multimap copy(other);
+    *this = std::move(copy);
+    return *this;
+  }
+  multimap &operator=(multimap &&other) {
+    tree_ = std::move(other.tree_);
+    return *this;
+  }
+
+  // ITERATORS
+  iterator begin() { return tree_.begin(); }
+  const_iterator begin() const { return tree_.begin(); }
+  iterator end() { return tree_.end(); }
+  const_iterator end() const { return tree_.end(); }
+
+  // MAIN FUNCTIONS
+  bool empty() const { return !tree_.count_; }
+  size_type size() const { return tree_.count_; }
+  size_type max_size() const {
+    return std::numeric_limits<std::ptrdiff_t>::max() /
+           sizeof(typename tree::node);
+  }
+  key_compare key_comp() const { return tree_.key_comp(); }
+  void swap(multimap &other) { tree_ = std::move(other.tree_); }
+  void clear() { tree_.clear(); }
+
+  iterator insert(const value_type &value) {
+    return iterator(tree_.insertEqual(value.first, value.second));
+  }
+  iterator insert(const key_type &key, const mapped_type &obj) {
+    return iterator(tree_.insertEqual(key, obj));
+  }
+  iterator insert(key_type &&key, mapped_type &&obj) {
+    return iterator(tree_.insertEqual(std::move(key), std::move(obj)));
+  }
+  template <typename... Args>
+  iterator emplace(Args &&...args) {
+    return iterator(tree_.insertEqual(std::forward<Args>(args)...));
+  }
+
+  // The first entry with key, or end().
+  iterator find(const key_type &key) {
+    iterator res = lower_bound(key);
+    return res != end() && !key_comp()(key, res->key_) ? res : end();
+  }
+  const_iterator find(const key_type &key) const {
+    const_iterator res = lower_bound(key);
+    return res != end() && !key_comp()(key, res->key_) ? res : end();
+  }
+  bool contains(const key_type &key) const { return find(key) != end(); }
+  // O(log n + k) for k entries with key.
+  size_type count(const key_type &key) const {
+    size_type res = 0;
+    for (auto range = equal_range(key); range.first != range.second;
+         ++range.first) {
+      ++res;
+    }
+    return res;
+  }
+
+  // RANGE LOOKUP
+  iterator lower_bound(const key_type &key) {
+    return iterator(tree_.lowerBound(key));
+  }
+  const_iterator lower_bound(const key_type &key) const {
+    return const_iterator(tree_.lowerBound(key));
+  }
+  iterator upper_bound(const key_type &key) {
+    return iterator(tree_.upperBound(key));
+  }
+  const_iterator upper_bound(const key_type &key) const {
+    return const_iterator(tree_.upperBound(key));
+  }
+  std::pair<iterator, iterator> equal_range(const key_type &key) {
+    return std::make_pair(lower_bound(key), upper_bound(key));
+  }
+  std::pair<const_iterator, const_iterator> equal_range(
+      const key_type &key) const {
+    return std::make_pair(lower_bound(key), upper_bound(key));
+  }
+
+  void erase(iterator pos) { tree_.erase(pos); }
+  // Removes every entry with key in O(k + log n) and returns k.
+  size_type erase(const key_type &key) {
+    return tree_.erase(lower_bound(key), upper_bound(key));
+  }
+  // Moves over all entries of other, after the equivalent ones here.
+  void merge(multimap &other) { tree_.mergeEqual(other.tree_); }
+
+ private:
+  tree tree_;
+};
+}  // namespace s21
+#endif  // CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_MULTIMAP_H_
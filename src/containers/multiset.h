@@ -0,0 +1,208 @@
+#ifndef CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_MULTISET_H_
+#define CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_MULTISET_H_
+
+#include "tree.h"
+
+namespace s21 {
+// set that keeps duplicates. Each distinct key is one tree node whose
+// value counts its copies, so repeated keys cost no extra nodes and
+// count() is O(log n). The copies are one stored key: of several
+// equivalent but distinct keys only the first inserted is kept.
+template <typename T, typename Compare = std::less<T>,
+          typename Allocator = std::allocator<T>>
+class multiset {
+ public:
+  using tree = Tree<T, size_t, Compare, Allocator>;
+  using key_type = T;
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+  using key_compare = Compare;
+  using allocator_type = Allocator;
+
+  // Walks each node once per copy; index_ is the copy it stands on.
+  class multisetIterator {
+   public:
+    /* ----- TYPES ----- */
+    using node_iterator = typename tree::const_iterator;
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T *;
+    using reference = const T &;
+
+    multisetIterator() : node_(), index_(0){};
+    explicit multisetIterator(node_iterator node, size_type index = 0)
+        : node_(node), index_(index){};
+
+    multisetIterator &operator++() {
+      if (++index_ == node_->value_) {
+        ++node_;
+        index_ = 0;
+      }
+      return *this;
+    }
+    multisetIterator &operator--() {
+      if (index_) {
+        --index_;
+      } else {
+        --node_;
+        index_ = node_->value_ - 1;
+      }
+      return *this;
+    }
+    multisetIterator operator++(int) {
+      multisetIterator ret_it(*this);
+      ++(*this);
+      return ret_it;
+    }
+    multisetIterator operator--(int) {
+      multisetIterator ret_it(*this);
+      --(*this);
+      return ret_it;
+    }
+
+    bool operator==(const multisetIterator &other) const {
+      return node_ == other.node_ && index_ == other.index_;
+    }
+    bool operator!=(const multisetIterator &other) const {
+      return !(*this == other);
+    }
+
+    reference operator*() const { return node_->key_; }
+    pointer operator->() const { return &node_->key_; }
+
+   private:
+    friend class multiset;
+
+    node_iterator node_;
+    size_type index_;
+  };
+
+  // Erasing a copy invalidates the iterators to the last copy of its key.
+  using iterator = multisetIterator;
+  using const_iterator = multisetIterator;
+
+  // CONSTRUCTORS
+  multiset() = default;
+  explicit multiset(const Compare &comp, const Allocator &alloc = Allocator())
+      : tree_(comp, alloc) {}
+  multiset(std::initializer_list<value_type> const &items,
+           const Compare &comp = Compare(),
+           const Allocator &alloc = Allocator())
+      : tree_(comp, alloc) {
+    for (const value_type &item : items) insert(item);
+  }
+  multiset(const multiset &other) : tree_(other.tree_), size_(other.size_) {}
+  multiset(multiset &&other)
+      : tree_(std::move(other.tree_)), size_(other.size_) {
+    other.size_ = 0;
+  }
+
+  // DESTRUCTOR
+  ~multiset() = default;
+
+  // OVERLOAD OPERATORS
+  multiset &operator=(const multiset &other) {
+    multiset copy(other);
+    *this = std::move(copy);
+    return *this;
+  }
+  multiset &operator=(multiset &&other) {
+    tree_ = std::move(other.tree_);
+    std::swap(size_, other.size_);
+    return *this;
+  }
+
+  // ITERATORS
+  iterator begin() const { return iterator(tree_.begin()); }
+  iterator end() const { return iterator(tree_.end()); }
+
+  // MAIN FUNCTIONS
+  bool empty() const { return !size_; }
+  size_type size() const { return size_; }
+  // Number of distinct keys, i.e. of tree nodes.
+  size_type unique_size() const { return tree_.count_; }
+  size_type max_size() const {
+    return std::numeric_limits<std::ptrdiff_t>::max() /
+           sizeof(typename tree::node);
+  }
+  key_compare key_comp() const { return tree_.key_comp(); }
+  key_compare value_comp() const { return tree_.key_comp(); }
+  void swap(multiset &other) { *this = std::move(other); }
+  void clear() {
+    tree_.clear();
+    size_ = 0;
+  }
+
+  // Returns the new, last copy of value.
+  iterator insert(const value_type &value) {
+    auto res = tree_.insertUnique(value, 0);
+    ++size_;
+    return iterator(typename tree::const_iterator(res.first),
+                    res.first->value_++);
+  }
+  iterator insert(value_type &&value) {
+    auto res = tree_.insertUnique(std::move(value), 0);
+    ++size_;
+    return iterator(typename tree::const_iterator(res.first),
+                    res.first->value_++);
+  }
+
+  // The first copy of key, or end().
+  iterator find(const key_type &key) const {
+    auto res = tree_.findNode(key);
+    return res ? iterator(typename tree::const_iterator(res)) : end();
+  }
+  bool contains(const key_type &key) const { return tree_.findNode(key); }
+  size_type count(const key_type &key) const {
+    auto res = tree_.findNode(key);
+    return res ? res->value_ : 0;
+  }
+
+  // RANGE LOOKUP
+  iterator lower_bound(const key_type &key) const {
+    return iterator(typename tree::const_iterator(tree_.lowerBound(key)));
+  }
+  iterator upper_bound(const key_type &key) const {
+    return iterator(typename tree::const_iterator(tree_.upperBound(key)));
+  }
+  std::pair<iterator, iterator> equal_range(const key_type &key) const {
+    auto res = tree_.equalRange(key);
+    return std::make_pair(
+        iterator(typename tree::const_iterator(res.first)),
+        iterator(typename tree::const_iterator(res.second)));
+  }
+
+  // Removes the copy at pos.
+  void erase(iterator pos) {
+    auto *target = const_cast<typename tree::node *>(&*pos.node_);
+    --size_;
+    if (--target->value_ == 0) tree_.erase(typename tree::iterator(target));
+  }
+  // Removes every copy of key and returns how many there were.
+  size_type erase(const key_type &key) {
+    auto res = tree_.findNode(key);
+    if (!res) return 0;
+    size_type copies = res->value_;
+    tree_.erase(typename tree::iterator(res));
+    size_ -= copies;
+    return copies;
+  }
+  // Moves all copies of other over and leaves it empty.
+  void merge(multiset &other) {
+    if (&other == this) return;
+    for (auto it = other.tree_.begin(); it != other.tree_.end(); ++it) {
+      tree_.insertUnique(it->key_, 0).first->value_ += it->value_;
+    }
+    size_ += other.size_;
+    other.clear();
+  }
+
+ private:
+  tree tree_;
+  size_type size_ = 0;
+};
+}  // namespace s21
+#endif  // CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_MULTISET_H_
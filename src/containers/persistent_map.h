@@ -0,0 +1,376 @@
+#ifndef CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_PERSISTENT_MAP_H_
+#define CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_PERSISTENT_MAP_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+namespace s21 {
+// Map whose versions share structure. Nodes are immutable and reference
+// counted; a write copies only the nodes on the path from the root to
+// the change and keeps pointing at everything else, so snapshot() and
+// the copy constructor are O(1) and an insert or erase allocates
+// O(log n) nodes. A snapshot can be handed to another thread: the
+// counts are atomic and no node reachable from it is ever modified.
+template <typename K, typename V, typename Compare = std::less<K>>
+class persistent_map {
+ private:
+  struct node {
+    node(const K &key, const V &value, node *left, node *right)
+        : key_(key), value_(value), left_(left), right_(right) {
+      height_ = 1 + std::max(heightOf(left), heightOf(right));
+    }
+
+    const K key_;
+    const V value_;
+    node *const left_;
+    node *const right_;
+    int height_;
+    std::atomic<size_t> refs_{1};
+  };
+
+ public:
+  using key_type = K;
+  using mapped_type = V;
+  using key_compare = Compare;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using size_type = size_t;
+
+  // In-order walk over one version; keeps the path from the root.
+  class persistentIterator {
+   public:
+    /* ----- TYPES ----- */
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = node;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const node *;
+    using reference = const node &;
+
+    persistentIterator() : path_(), depth_(0){};
+
+    persistentIterator &operator++() {
+      const node *cur = path_[depth_ - 1];
+      if (cur->right_) {
+        pushLeft(cur->right_);
+      } else {
+        for (--depth_; depth_ && path_[depth_ - 1]->right_ == cur; --depth_) {
+          cur = path_[depth_ - 1];
+        }
+      }
+      return *this;
+    }
+    persistentIterator operator++(int) {
+      persistentIterator ret_it(*this);
+      ++(*this);
+      return ret_it;
+    }
+
+    bool operator==(const persistentIterator &other) const {
+      return current() == other.current();
+    }
+    bool operator!=(const persistentIterator &other) const {
+      return current() != other.current();
+    }
+
+    reference operator*() const { return *path_[depth_ - 1]; }
+    pointer operator->() const { return path_[depth_ - 1]; }
+
+   private:
+    friend class persistent_map;
+
+    // An AVL tree this deep would need more than 10^13 nodes.
+    static constexpr size_type kMaxDepth = 64;
+
+    const node *current() const { return depth_ ? path_[depth_ - 1] : nullptr; }
+    void pushLeft(const node *cur) {
+      for (; cur; cur = cur->left_) path_[depth_++] = cur;
+    }
+
+    const node *path_[kMaxDepth];
+    size_type depth_;
+  };
+
+  using iterator = persistentIterator;
+  using const_iterator = persistentIterator;
+
+  // CONSTRUCTORS
+  persistent_map() = default;
+  explicit persistent_map(const Compare &comp) : comp_(comp) {}
+  persistent_map(std::initializer_list<value_type> const &items,
+                 const Compare &comp = Compare())
+      : comp_(comp) {
+    for (const value_type &item : items) insert(item.first, item.second);
+  }
+  persistent_map(const persistent_map &other)
+      : root_(retain(other.root_)), count_(other.count_), comp_(other.comp_) {}
+  persistent_map(persistent_map &&other) : comp_(other.comp_) { swap(other); }
+
+  // DESTRUCTOR
+  ~persistent_map() { release(root_); }
+
+  // OVERLOAD OPERATORS
+  persistent_map &operator=(const persistent_map &other) {
+    persistent_map copy(other);
+    swap(copy);
+    return *this;
+  }
+  persistent_map &operator=(persistent_map &&other) {
+    swap(other);
+    return *this;
+  }
+
+  // A read-only version that later writes to this map do not affect.
+  persistent_map snapshot() const { return *this; }
+
+  const mapped_type &at(const key_type &key) const {
+    const node *res = findNode(key);
+    if (!res) throw std::out_of_range("Key does not exist");
+    return res->value_;
+  }
+
+  // ITERATORS
+  const_iterator begin() const {
+    const_iterator it;
+    it.pushLeft(root_);
+    return it;
+  }
+  const_iterator end() const { return const_iterator(); }
+
+  // MAIN FUNCTIONS
+  bool empty() const { return !count_; }
+  size_type size() const { return count_; }
+  key_compare key_comp() const { return comp_; }
+  bool contains(const key_type &key) const { return findNode(key); }
+  const_iterator find(const key_type &key) const {
+    const_iterator it;
+    for (const node *cur = root_; cur;) {
+      it.path_[it.depth_++] = cur;
+      if (comp_(key, cur->key_)) {
+        cur = cur->left_;
+      } else if (comp_(cur->key_, key)) {
+        cur = cur->right_;
+      } else {
+        return it;
+      }
+    }
+    return end();
+  }
+  // True when both maps are the same version, i.e. share their root.
+  bool shares_root(const persistent_map &other) const {
+    return root_ == other.root_;
+  }
+
+  std::pair<const_iterator, bool> insert(const key_type &key,
+                                         const mapped_type &obj) {
+    bool inserted = update(key, obj, false);
+    return std::make_pair(find(key), inserted);
+  }
+  std::pair<const_iterator, bool> insert(const value_type &value) {
+    return insert(value.first, value.second);
+  }
+  std::pair<const_iterator, bool> insert_or_assign(const key_type &key,
+                                                   const mapped_type &obj) {
+    bool inserted = update(key, obj, true);
+    return std::make_pair(find(key), inserted);
+  }
+  size_type erase(const key_type &key) {
+    bool erased = false;
+    node *root = eraseFrom(root_, key, erased);
+    release(root_);
+    root_ = root;
+    count_ -= erased;
+    return erased;
+  }
+  void swap(persistent_map &other) {
+    std::swap(root_, other.root_);
+    std::swap(count_, other.count_);
+    std::swap(comp_, other.comp_);
+  }
+  void clear() {
+    release(root_);
+    root_ = nullptr;
+    count_ = 0;
+  }
+
+ private:
+  static int heightOf(const node *cur) { return cur ? cur->height_ : 0; }
+  static node *retain(node *cur) {
+    if (cur) cur->refs_.fetch_add(1, std::memory_order_relaxed);
+    return cur;
+  }
+  // Drops one reference; nodes that reach zero free their children's
+  // references in turn. Runs iteratively along left spines.
+  static void release(node *cur) {
+    while (cur && cur->refs_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      node *left = cur->left_;
+      release(cur->right_);
+      delete cur;
+      cur = left;
+    }
+  }
+
+  const node *findNode(const key_type &key) const {
+    const node *cur = root_;
+    while (cur) {
+      if (comp_(key, cur->key_)) {
+        cur = cur->left_;
+      } else if (comp_(cur->key_, key)) {
+        cur = cur->right_;
+      } else {
+        break;
+      }
+    }
+    return cur;
+  }
+
+  bool update(const key_type &key, const mapped_type &obj, bool assign) {
+    bool inserted = false;
+    node *root = insertInto(root_, key, obj, assign, inserted);
+    release(root_);
+    root_ = root;
+    count_ += inserted;
+    return inserted;
+  }
+
+  // Owns one reference until it is handed on with take(), so a throwing
+  // copy of a key or value drops the partly rebuilt path.
+  class ownedRef {
+   public:
+    explicit ownedRef(node *cur) : node_(cur) {}
+    ownedRef(const ownedRef &) = delete;
+    ownedRef &operator=(const ownedRef &) = delete;
+    ~ownedRef() { release(node_); }
+
+    node *take() {
+      node *result = node_;
+      node_ = nullptr;
+      return result;
+    }
+
+   private:
+    node *node_;
+  };
+
+  // Takes over the references to left and right, dropping them if the
+  // key or value copy throws.
+  static node *makeNode(const key_type &key, const mapped_type &value,
+                        node *left, node *right) {
+    try {
+      return new node(key, value, left, right);
+    } catch (...) {
+      release(left);
+      release(right);
+      throw;
+    }
+  }
+
+  // Each of the following returns a new reference to the root of the
+  // updated subtree and takes over the references passed in as children,
+  // also when it throws. New nodes are built one statement at a time,
+  // never as nested arguments, so every reference has an owner.
+
+  // Builds key/value over left and right, rotating once or twice when
+  // their heights differ by two.
+  node *balance(const key_type &key, const mapped_type &value, node *left,
+                node *right) {
+    ownedRef lhs(left);
+    ownedRef rhs(right);
+    if (heightOf(left) > heightOf(right) + 1) {
+      if (heightOf(left->left_) >= heightOf(left->right_)) {
+        ownedRef lower(
+            makeNode(key, value, retain(left->right_), rhs.take()));
+        return makeNode(left->key_, left->value_, retain(left->left_),
+                        lower.take());
+      }
+      node *pivot = left->right_;
+      ownedRef lower_left(makeNode(left->key_, left->value_,
+                                   retain(left->left_), retain(pivot->left_)));
+      ownedRef lower_right(
+          makeNode(key, value, retain(pivot->right_), rhs.take()));
+      return makeNode(pivot->key_, pivot->value_, lower_left.take(),
+                      lower_right.take());
+    }
+    if (heightOf(right) > heightOf(left) + 1) {
+      if (heightOf(right->right_) >= heightOf(right->left_)) {
+        ownedRef lower(
+            makeNode(key, value, lhs.take(), retain(right->left_)));
+        return makeNode(right->key_, right->value_, lower.take(),
+                        retain(right->right_));
+      }
+      node *pivot = right->left_;
+      ownedRef lower_left(
+          makeNode(key, value, lhs.take(), retain(pivot->left_)));
+      ownedRef lower_right(makeNode(right->key_, right->value_,
+                                    retain(pivot->right_),
+                                    retain(right->right_)));
+      return makeNode(pivot->key_, pivot->value_, lower_left.take(),
+                      lower_right.take());
+    }
+    return makeNode(key, value, lhs.take(), rhs.take());
+  }
+
+  // Untouched subtrees come back as the same node, so a no-op write
+  // copies nothing.
+  node *insertInto(node *cur, const key_type &key, const mapped_type &obj,
+                   bool assign, bool &inserted) {
+    if (!cur) {
+      inserted = true;
+      return makeNode(key, obj, nullptr, nullptr);
+    }
+    if (comp_(key, cur->key_)) {
+      node *left = insertInto(cur->left_, key, obj, assign, inserted);
+      if (left == cur->left_) return keep(cur, left);
+      return balance(cur->key_, cur->value_, left, retain(cur->right_));
+    }
+    if (comp_(cur->key_, key)) {
+      node *right = insertInto(cur->right_, key, obj, assign, inserted);
+      if (right == cur->right_) return keep(cur, right);
+      return balance(cur->key_, cur->value_, retain(cur->left_), right);
+    }
+    if (!assign) return retain(cur);
+    return makeNode(cur->key_, obj, retain(cur->left_), retain(cur->right_));
+  }
+
+  node *eraseFrom(node *cur, const key_type &key, bool &erased) {
+    if (!cur) return nullptr;
+    if (comp_(key, cur->key_)) {
+      node *left = eraseFrom(cur->left_, key, erased);
+      if (left == cur->left_) return keep(cur, left);
+      return balance(cur->key_, cur->value_, left, retain(cur->right_));
+    }
+    if (comp_(cur->key_, key)) {
+      node *right = eraseFrom(cur->right_, key, erased);
+      if (right == cur->right_) return keep(cur, right);
+      return balance(cur->key_, cur->value_, retain(cur->left_), right);
+    }
+    erased = true;
+    if (!cur->left_) return retain(cur->right_);
+    if (!cur->right_) return retain(cur->left_);
+    const node *next = cur->right_;
+    while (next->left_) next = next->left_;
+    node *right = eraseMin(cur->right_);
+    return balance(next->key_, next->value_, retain(cur->left_), right);
+  }
+  node *eraseMin(node *cur) {
+    if (!cur->left_) return retain(cur->right_);
+    node *left = eraseMin(cur->left_);
+    return balance(cur->key_, cur->value_, left, retain(cur->right_));
+  }
+
+  // Returns cur itself when its child came back unchanged.
+  static node *keep(node *cur, node *child) {
+    release(child);
+    return retain(cur);
+  }
+
+  node *root_ = nullptr;
+  size_type count_ = 0;
+  Compare comp_;
+};
+}  // namespace s21
+#endif  // CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_PERSISTENT_MAP_H_
@@ -0,0 +1,215 @@
+#ifndef CPP2_S21_CONTAINERS_SRC_CONTAINERS_POOL_ALLOCATOR_H_
+#define CPP2_S21_CONTAINERS_SRC_CONTAINERS_POOL_ALLOCATOR_H_
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+// Storage behind pool_allocator, shared by its copies. It keeps one free
+// list per slot size, so allocators rebound to different types share it
+// and still hand out slots of the right size.
+template <size_t NodesPerChunk>
+class poolState {
+  // Slots start right after the header, aligned for any object.
+  struct alignas(std::max_align_t) chunk {
+    chunk *next;
+  };
+
+ public:
+  poolState() = default;
+  poolState(const poolState &) = delete;
+  poolState &operator=(const poolState &) = delete;
+  ~poolState() {
+    releaseChunks();
+    while (classes_) {
+      sizeClass *next = classes_->next;
+      delete classes_;
+      classes_ = next;
+    }
+  }
+
+  // Slots of one size: chunks of NodesPerChunk slots plus the free list.
+  struct sizeClass {
+    size_t slot_bytes;
+    sizeClass *next;
+    chunk *chunks = nullptr;
+    void *free = nullptr;
+    size_t used = 0;
+  };
+
+  // Finds the class for slot_bytes, adding it when create is set.
+  sizeClass *classFor(size_t slot_bytes, bool create) {
+    for (sizeClass *it = classes_; it; it = it->next) {
+      if (it->slot_bytes == slot_bytes) return it;
+    }
+    if (!create) return nullptr;
+    classes_ = new sizeClass{slot_bytes, classes_};
+    return classes_;
+  }
+
+  void *allocate(sizeClass *cls) {
+    if (cls->free) {
+      void *result = cls->free;
+      cls->free = *static_cast<void **>(result);
+      return result;
+    }
+    if (!cls->chunks || cls->used == NodesPerChunk) {
+      void *raw =
+          ::operator new(sizeof(chunk) + NodesPerChunk * cls->slot_bytes);
+      cls->chunks = new (raw) chunk{cls->chunks};
+      cls->used = 0;
+    }
+    return reinterpret_cast<unsigned char *>(cls->chunks + 1) +
+           cls->slot_bytes * cls->used++;
+  }
+  static void deallocate(sizeClass *cls, void *ptr) noexcept {
+    *static_cast<void **>(ptr) = cls->free;
+    cls->free = ptr;
+  }
+
+  static size_t chunks(const sizeClass *cls) noexcept {
+    size_t result = 0;
+    for (const chunk *it = cls ? cls->chunks : nullptr; it; it = it->next) {
+      ++result;
+    }
+    return result;
+  }
+  // Frees every chunk of every size without running destructors.
+  void releaseChunks() noexcept {
+    for (sizeClass *it = classes_; it; it = it->next) {
+      while (it->chunks) {
+        chunk *next = it->chunks->next;
+        ::operator delete(it->chunks);
+        it->chunks = next;
+      }
+      it->free = nullptr;
+      it->used = 0;
+    }
+  }
+
+
+ private:
+  sizeClass *classes_ = nullptr;
+};
+
+// Single-object allocator that carves objects out of chunks of
+// NodesPerChunk slots and recycles freed slots through a free list.
+// Copies, rebound ones included, share one pool through a shared_ptr and
+// compare equal, so a node handle can hand its node back to the tree it
+// came from and keeps the pool alive while it holds one. A container
+// copy starts a pool of its own. Not thread-safe.
+template <typename T, size_t NodesPerChunk = 512>
+class pool_allocator {
+  static_assert(alignof(T) <= alignof(std::max_align_t),
+                "pool_allocator slots are aligned to max_align_t at most");
+
+ public:
+  using value_type = T;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+  using is_always_equal = std::false_type;
+
+  template <typename U>
+  struct rebind {
+    using other = pool_allocator<U, NodesPerChunk>;
+  };
+
+  // CONSTRUCTORS AND DESTRUCTOR
+  pool_allocator() : pool_(std::make_shared<state>()) {}
+  pool_allocator(const pool_allocator &other) noexcept
+      : pool_(other.pool_), class_(other.class_) {}
+  template <typename U>
+  pool_allocator(const pool_allocator<U, NodesPerChunk> &other) noexcept
+      : pool_(other.pool_) {}
+  // A moved-from allocator holds no pool and may only be assigned to or
+  // destroyed.
+  pool_allocator(pool_allocator &&other) noexcept
+      : pool_(std::move(other.pool_)), class_(other.class_) {
+    other.class_ = nullptr;
+  }
+  pool_allocator &operator=(const pool_allocator &other) noexcept {
+    pool_allocator copy(other);
+    swap(copy);
+    return *this;
+  }
+  pool_allocator &operator=(pool_allocator &&other) noexcept {
+    swap(other);
+    return *this;
+  }
+  ~pool_allocator() = default;
+
+  pool_allocator select_on_container_copy_construction() const {
+    return pool_allocator();
+  }
+
+  // MAIN FUNCTIONS
+  T *allocate(size_type n) {
+    if (n != 1) return static_cast<T *>(::operator new(n * sizeof(T)));
+    if (!class_) class_ = pool_->classFor(kSlotBytes, true);
+    return static_cast<T *>(pool_->allocate(class_));
+  }
+  void deallocate(T *ptr, size_type n) noexcept {
+    if (n != 1) {
+      ::operator delete(ptr);
+      return;
+    }
+    if (!class_) class_ = pool_->classFor(kSlotBytes, false);
+    state::deallocate(class_, ptr);
+  }
+
+  // Drops every chunk at once without running destructors; objects still
+  // living in the pool must not be touched afterwards. Does nothing and
+  // returns false while another copy shares the pool.
+  bool release() noexcept {
+    if (pool_.use_count() != 1) return false;
+    pool_->releaseChunks();
+    return true;
+  }
+  // Chunks holding slots of this allocator's size.
+  size_type chunks() const noexcept {
+    if (class_) return state::chunks(class_);
+    return state::chunks(pool_->classFor(kSlotBytes, false));
+  }
+
+  void swap(pool_allocator &other) noexcept {
+    pool_.swap(other.pool_);
+    std::swap(class_, other.class_);
+  }
+
+  template <typename U>
+  bool operator==(
+      const pool_allocator<U, NodesPerChunk> &other) const noexcept {
+    return pool_ == other.pool_;
+  }
+  template <typename U>
+  bool operator!=(
+      const pool_allocator<U, NodesPerChunk> &other) const noexcept {
+    return pool_ != other.pool_;
+  }
+
+ private:
+  template <typename, size_t>
+  friend class pool_allocator;
+
+  using state = poolState<NodesPerChunk>;
+
+  // Room for the object or a free-list link, rounded up so that every
+  // slot in a chunk stays aligned for both.
+  static constexpr size_type kSlotAlign =
+      alignof(T) > alignof(void *) ? alignof(T) : alignof(void *);
+  static constexpr size_type kSlotBytes =
+      ((sizeof(T) > sizeof(void *) ? sizeof(T) : sizeof(void *)) +
+       kSlotAlign - 1) /
+      kSlotAlign * kSlotAlign;
+
+  std::shared_ptr<state> pool_;
+  typename state::sizeClass *class_ = nullptr;
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_SRC_CONTAINERS_POOL_ALLOCATOR_H_
@@ -1,13 +1,16 @@
 #ifndef CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_SET_H_
 #define CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_SET_H_
 
+#include "frozen_set.h"
 #include "tree.h"
 
 namespace s21 {
-template <typename T>
+template <typename T, typename Compare = std::less<T>,
+          typename Allocator = std::allocator<T>,
+          bool Ranked = false>
 class set {
  public:
-  using tree = Tree<T, T>;
+  using tree = Tree<T, void, Compare, Allocator, Ranked>;
   using key_type = T;
   using value_type = T;
   using reference = T &;
@@ -15,16 +18,33 @@ class set {
   using iterator = typename tree::key_iterator;
   using const_iterator = typename tree::const_key_iterator;
   using size_type = size_t;
+  using node_type = typename tree::node_type;
+  using insert_return_type = treeInsertReturn<iterator, node_type>;
+  using key_compare = Compare;
+  using allocator_type = Allocator;
 
   // CONSTRUCTORS
   set() = default;
-  set(std::initializer_list<value_type> const &items) {
-    for (auto it = items.begin(); it != items.end(); ++it)
-      if (!tree_.findNode(*it)) tree_.insert(*it, *it);
+  explicit set(const Compare &comp, const Allocator &alloc = Allocator())
+      : tree_(comp, alloc) {}
+  set(std::initializer_list<value_type> const &items,
+      const Compare &comp = Compare(), const Allocator &alloc = Allocator())
+      : tree_(comp, alloc) {
+    tree_.insertSorted(items.begin(), items.end());
   }
   set(const set &other) : tree_(other.tree_) {}
   set(set &&other) : tree_(std::move(other.tree_)) {}
 
+  // Builds from a range sorted by comp in O(n); see insert_sorted.
+  template <typename InputIt>
+  static set from_sorted(InputIt first, InputIt last,
+                         const Compare &comp = Compare(),
+                         const Allocator &alloc = Allocator()) {
+    set result(comp, alloc);
+    result.insert_sorted(first, last);
+    return result;
+  }
+
   // DESTRUCTOR
   ~set() = default;
 
@@ -44,42 +64,162 @@ class set {
   size_type size() const { return tree_.count_; }
   // size_type max_size() const {return size_type(-1); }
   size_type max_size() const {
-    return std::numeric_limits<size_type>::max() / sizeof(Tree<T, T>) / 5;
+    return std::numeric_limits<std::ptrdiff_t>::max() /
+           sizeof(typename tree::node);
   }
+  key_compare key_comp() const { return tree_.key_comp(); }
+  key_compare value_comp() const { return tree_.key_comp(); }
   void swap(set &other) { tree_ = std::move(other.tree_); }
-  void clear() {
-    if (tree_.root_) delete tree_.root_;
-    tree_.root_ = nullptr;
-    tree_.count_ = 0;
-  }
+  void clear() { tree_.clear(); }
 
   iterator find(const value_type &key) {
-    auto node = tree_.findNode(key);
-    if (node) {
-      return iterator(node);
-    } else {
-      return ++iterator(tree_.root_->findMax());
-    }
+    return toIterator(tree_.findNode(key));
+  }
+  template <typename L, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const L &key) {
+    return toIterator(tree_.findNode(key));
   }
   bool contains(const value_type &key) {
     return tree_.findNode(key) ? true : false;
   }
+  template <typename L, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const L &key) {
+    return tree_.findNode(key) ? true : false;
+  }
 
   std::pair<iterator, bool> insert(const value_type &value) {
-    bool exist = tree_.findNode(value);
-    if (!exist) tree_.insert(value, value);
-    iterator iter(tree_.findNode(value));
-    return std::make_pair(iter, !exist);
+    auto res = tree_.insertUnique(value);
+    return std::make_pair(iterator(res.first), res.second);
+  }
+  std::pair<iterator, bool> insert(value_type &&value) {
+    auto res = tree_.insertUnique(std::move(value));
+    return std::make_pair(iterator(res.first), res.second);
+  }
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    auto res = tree_.emplaceUnique(std::forward<Args>(args)...);
+    return std::make_pair(iterator(res.first), res.second);
   }
-  void erase(iterator iter) {
-    if (iter != end())
-      tree_.remove(*iter);
-    else if (iter == end() && iter != nullptr)
-      tree_.remove(*iter);
+  // NODE HANDLES
+  node_type extract(iterator pos) { return tree_.extract(pos); }
+  node_type extract(const key_type &key) {
+    auto res = tree_.findNode(key);
+    return res ? tree_.extract(iterator(res)) : node_type();
   }
-  void merge(set &other) {
-    for (auto it = other.begin(); it != other.end(); ++it) insert(*it);
-    clear(other);
+  insert_return_type insert(node_type &&handle) {
+    if (handle.empty()) return {end(), false, node_type()};
+    auto res = tree_.insertHandle(handle);
+    return {iterator(res.first), res.second, std::move(handle)};
+  }
+
+  // RANGE LOOKUP
+  iterator lower_bound(const key_type &key) {
+    return iterator(tree_.lowerBound(key));
+  }
+  const_iterator lower_bound(const key_type &key) const {
+    return const_iterator(tree_.lowerBound(key));
+  }
+  template <typename L, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator lower_bound(const L &key) {
+    return iterator(tree_.lowerBound(key));
+  }
+  template <typename L, typename C = Compare,
+            typename = typename C::is_transparent>
+  const_iterator lower_bound(const L &key) const {
+    return const_iterator(tree_.lowerBound(key));
+  }
+  iterator upper_bound(const key_type &key) {
+    return iterator(tree_.upperBound(key));
+  }
+  const_iterator upper_bound(const key_type &key) const {
+    return const_iterator(tree_.upperBound(key));
+  }
+  template <typename L, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator upper_bound(const L &key) {
+    return iterator(tree_.upperBound(key));
+  }
+  template <typename L, typename C = Compare,
+            typename = typename C::is_transparent>
+  const_iterator upper_bound(const L &key) const {
+    return const_iterator(tree_.upperBound(key));
+  }
+  std::pair<iterator, iterator> equal_range(const key_type &key) {
+    auto res = tree_.equalRange(key);
+    return std::make_pair(iterator(res.first), iterator(res.second));
+  }
+  std::pair<const_iterator, const_iterator> equal_range(
+      const key_type &key) const {
+    auto res = tree_.equalRange(key);
+    return std::make_pair(const_iterator(res.first),
+                          const_iterator(res.second));
+  }
+  template <typename L, typename C = Compare,
+            typename = typename C::is_transparent>
+  std::pair<iterator, iterator> equal_range(const L &key) {
+    auto res = tree_.equalRange(key);
+    return std::make_pair(iterator(res.first), iterator(res.second));
+  }
+  template <typename L, typename C = Compare,
+            typename = typename C::is_transparent>
+  std::pair<const_iterator, const_iterator> equal_range(const L &key) const {
+    auto res = tree_.equalRange(key);
+    return std::make_pair(const_iterator(res.first),
+                          const_iterator(res.second));
+  }
+
+  // ORDER STATISTICS
+  // Only available when Ranked is set; each query is O(log n).
+  iterator nth_element(size_type k) {
+    auto res = tree_.selectNode(k);
+    return res ? iterator(res) : end();
+  }
+  const_iterator nth_element(size_type k) const {
+    auto res = tree_.selectNode(k);
+    return res ? const_iterator(res) : end();
+  }
+  size_type rank(const key_type &key) const { return tree_.rank(key); }
+  size_type count_range(const key_type &lo, const key_type &hi) const {
+    return tree_.countRange(lo, hi);
+  }
+
+  // Linear when the container is empty and the range is sorted; keeps
+  // the first of equivalent elements like insert does.
+  template <typename InputIt>
+  void insert_sorted(InputIt first, InputIt last) {
+    tree_.insertSorted(first, last);
+  }
+  void erase(iterator iter) { tree_.erase(iter); }
+  iterator erase(iterator first, iterator last) {
+    tree_.erase(first, last);
+    return last;
+  }
+  // Removes the keys in [lo, hi) in O(k + log n) and returns k.
+  size_type erase_range(const key_type &lo, const key_type &hi) {
+    if (!key_comp()(lo, hi)) return 0;
+    return tree_.erase(lower_bound(lo), lower_bound(hi));
+  }
+  void merge(set &other) { tree_.merge(other.tree_); }
+
+  // SET ALGEBRA
+  // Each result is built in one pass over both sets, in O(n + m).
+  set set_union(const set &other) const {
+    return set(tree_.combine(other.tree_, true, true, true));
+  }
+  set set_intersection(const set &other) const {
+    return set(tree_.combine(other.tree_, false, true, false));
+  }
+  set set_difference(const set &other) const {
+    return set(tree_.combine(other.tree_, true, false, false));
+  }
+
+  // Copies the keys into a read-only Eytzinger index in O(n); later
+  // changes to the set are not reflected in it.
+  frozen_set<T, Compare> freeze() const {
+    return frozen_set<T, Compare>::from_sorted(begin(), size(), key_comp());
   }
 
   // ITERATORS FUNCTIONS
@@ -89,7 +229,18 @@ class set {
   const_iterator end() const { return tree_.kend(); }
 
  private:
+  iterator toIterator(typename tree::node *node) {
+    return node ? iterator(node) : end();
+  }
+
+  explicit set(tree &&other) : tree_(std::move(other)) {}
+
   tree tree_;
 };
+
+// set that also answers rank and select queries in O(log n).
+template <typename T, typename Compare = std::less<T>,
+          typename Allocator = std::allocator<T>>
+using ranked_set = set<T, Compare, Allocator, true>;
 }  // namespace s21
 #endif  // CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_SET_H_
\ No newline at end of file
@@ -0,0 +1,212 @@
+#ifndef CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_SHARDED_MAP_H_
+#define CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_SHARDED_MAP_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "map.h"
+
+namespace s21 {
+// Map split by key hash into Shards independent s21::maps, each behind
+// its own mutex on its own cache lines, so writers to different shards
+// never wait on each other. Every single-key operation locks only the
+// key's shard.
+template <typename K, typename V, size_t Shards = 16,
+          typename Hash = std::hash<K>, typename Compare = std::less<K>>
+class sharded_map {
+  static_assert(Shards > 0, "sharded_map needs at least one shard");
+
+ public:
+  using key_type = K;
+  using mapped_type = V;
+  using key_compare = Compare;
+  using hasher = Hash;
+  using size_type = size_t;
+  using shard_type = map<K, V, Compare>;
+
+  // CONSTRUCTORS
+  sharded_map() = default;
+  explicit sharded_map(const Hash &hash, const Compare &comp = Compare())
+      : hash_(hash), comp_(comp) {
+    for (shard &cur : shards_) cur.map_ = shard_type(comp);
+  }
+  sharded_map(const sharded_map &) = delete;
+  sharded_map &operator=(const sharded_map &) = delete;
+
+  // DESTRUCTOR
+  ~sharded_map() = default;
+
+  // MAIN FUNCTIONS
+  bool insert(const key_type &key, const mapped_type &obj) {
+    shard &cur = shardFor(key);
+    std::lock_guard<std::mutex> lock(cur.mutex_);
+    return cur.map_.insert(key, obj).second;
+  }
+  bool insert_or_assign(const key_type &key, const mapped_type &obj) {
+    shard &cur = shardFor(key);
+    std::lock_guard<std::mutex> lock(cur.mutex_);
+    return cur.map_.insert_or_assign(key, obj).second;
+  }
+  size_type erase(const key_type &key) {
+    shard &cur = shardFor(key);
+    std::lock_guard<std::mutex> lock(cur.mutex_);
+    auto it = cur.map_.find(key);
+    if (it == cur.map_.end()) return 0;
+    cur.map_.erase(it);
+    return 1;
+  }
+  bool contains(const key_type &key) const {
+    const shard &cur = shardFor(key);
+    std::lock_guard<std::mutex> lock(cur.mutex_);
+    return cur.map_.contains(key);
+  }
+  // Copies the value out, since the entry may change once the lock is
+  // released.
+  std::optional<mapped_type> find(const key_type &key) const {
+    const shard &cur = shardFor(key);
+    std::lock_guard<std::mutex> lock(cur.mutex_);
+    auto it = cur.map_.find(key);
+    if (it == cur.map_.end()) return std::nullopt;
+    return it->value_;
+  }
+  // Calls fn(value) on the entry for key under its shard's lock,
+  // default-constructing the value first if the key is missing.
+  template <typename Fn>
+  void update(const key_type &key, Fn fn) {
+    shard &cur = shardFor(key);
+    std::lock_guard<std::mutex> lock(cur.mutex_);
+    fn(cur.map_[key]);
+  }
+
+  // Locks the shards one at a time, so the total is exact only when no
+  // writer runs concurrently.
+  size_type size() const {
+    size_type total = 0;
+    for (const shard &cur : shards_) {
+      std::lock_guard<std::mutex> lock(cur.mutex_);
+      total += cur.map_.size();
+    }
+    return total;
+  }
+  bool empty() const { return !size(); }
+  // Entries in shard i, for checking how evenly the keys spread.
+  size_type shard_size(size_type i) const {
+    std::lock_guard<std::mutex> lock(shards_[i].mutex_);
+    return shards_[i].map_.size();
+  }
+  void clear() {
+    for (shard &cur : shards_) {
+      std::lock_guard<std::mutex> lock(cur.mutex_);
+      cur.map_.clear();
+    }
+  }
+
+  // ITERATION
+  // Calls fn(key, value) on every entry, visiting up to threads shards
+  // at once, so fn may run on several threads concurrently. Each shard
+  // is locked while it is visited; fn must not call back into this map.
+  // If fn (or starting a thread) throws, the started workers are still
+  // joined and the first exception is rethrown; a thread that failed
+  // stops visiting its shards.
+  template <typename Fn>
+  void for_each(Fn fn, size_type threads = defaultThreads()) {
+    threads = std::min(std::max<size_type>(threads, 1), Shards);
+    std::vector<std::exception_ptr> errors(threads);
+    std::vector<std::thread> workers;
+    try {
+      workers.reserve(threads - 1);
+      for (size_type t = 1; t < threads; ++t) {
+        workers.emplace_back([this, &fn, &errors, t, threads] {
+          try {
+            visitShards(fn, t, threads);
+          } catch (...) {
+            errors[t] = std::current_exception();
+          }
+        });
+      }
+      visitShards(fn, 0, threads);
+    } catch (...) {
+      errors[0] = std::current_exception();
+    }
+    for (std::thread &worker : workers) worker.join();
+    for (const std::exception_ptr &error : errors) {
+      if (error) std::rethrow_exception(error);
+    }
+  }
+  // Calls fn(key, value) on every entry in key order. All shards stay
+  // locked for the walk, so it sees one consistent state. A k-way merge
+  // over a heap of shards keyed by their next entry: O(n log Shards).
+  template <typename Fn>
+  void for_each_ordered(Fn fn) const {
+    std::vector<std::unique_lock<std::mutex>> locks;
+    for (const shard &cur : shards_) locks.emplace_back(cur.mutex_);
+    std::vector<typename shard_type::const_iterator> pos;
+    std::vector<size_type> heap;
+    for (size_type i = 0; i < Shards; ++i) {
+      pos.push_back(shards_[i].map_.begin());
+      if (pos[i] != shards_[i].map_.end()) heap.push_back(i);
+    }
+    // Keys never repeat across shards, so ties cannot happen.
+    auto later = [&](size_type lhs, size_type rhs) {
+      return comp_(pos[rhs]->key_, pos[lhs]->key_);
+    };
+    std::make_heap(heap.begin(), heap.end(), later);
+    while (!heap.empty()) {
+      std::pop_heap(heap.begin(), heap.end(), later);
+      size_type next = heap.back();
+      fn(pos[next]->key_, pos[next]->value_);
+      if (++pos[next] == shards_[next].map_.end()) {
+        heap.pop_back();
+      } else {
+        std::push_heap(heap.begin(), heap.end(), later);
+      }
+    }
+  }
+
+ private:
+  // Padded to whole cache lines so neighbouring shards' locks and tree
+  // headers never share one.
+  struct alignas(64) shard {
+    mutable std::mutex mutex_;
+    shard_type map_;
+  };
+
+  static size_type defaultThreads() {
+    size_type hardware = std::thread::hardware_concurrency();
+    return hardware ? hardware : 1;
+  }
+  // Fibonacci hashing, as in HashTable: the identity hash of
+  // std::hash<int> would otherwise send every key stride sharing a
+  // factor with Shards to the same few shards.
+  size_type shardIndex(const key_type &key) const {
+    uint64_t mixed =
+        static_cast<uint64_t>(hash_(key)) * 0x9E3779B97F4A7C15ull;
+    return static_cast<size_type>((mixed >> 32) % Shards);
+  }
+  shard &shardFor(const key_type &key) { return shards_[shardIndex(key)]; }
+  const shard &shardFor(const key_type &key) const {
+    return shards_[shardIndex(key)];
+  }
+  template <typename Fn>
+  void visitShards(Fn &fn, size_type first, size_type step) {
+    for (size_type i = first; i < Shards; i += step) {
+      std::lock_guard<std::mutex> lock(shards_[i].mutex_);
+      for (auto it = shards_[i].map_.begin(); it != shards_[i].map_.end();
+           ++it) {
+        fn(it->key_, it->value_);
+      }
+    }
+  }
+
+  shard shards_[Shards];
+  Hash hash_;
+  Compare comp_;
+};
+}  // namespace s21
+#endif  // CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_SHARDED_MAP_H_
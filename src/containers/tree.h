@@ -1,252 +1,425 @@
 #ifndef CPP2_S21_CONTAINERS_SRC_CONTAINERS_TREE_H_
 #define CPP2_S21_CONTAINERS_SRC_CONTAINERS_TREE_H_
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <iostream>
 #include <limits>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 namespace s21 {
-template <typename K, typename V>
-class Tree {
+template <typename T, int Index,
+          bool = std::is_empty<T>::value && !std::is_final<T>::value>
+class emptyBaseHolder : private T {
  public:
-  using key_type = K;
-  using mapped_type = V;
-  using value_type = std::pair<const key_type, mapped_type>;
-  using reference = value_type &;
-  using const_reference = const value_type &;
-  using size_type = size_t;
+  emptyBaseHolder() = default;
+  explicit emptyBaseHolder(const T &value) : T(value) {}
 
-  class node {
-   public:
-    /* ----- CONSTRUCTORS AND DESTRUCTORS ----- */
-    node(key_type key, mapped_type value) : key_(key), value_(value){};
-    node(const node &other)
-        : key_(other.key_), value_(other.value_), height(other.height){};
-    node(node &&other) { *this = std::move(other); };
-    node &operator=(const node &other) {
-      node cpy(other);
-      *this = std::swap(cpy);
-      return *this;
-    }
-    node &operator=(node &&other) {
-      std::swap(key_, other.key_);
-      std::swap(value_, other.value_);
-      std::swap(height, other.height);
-      std::swap(parent, other.parent);
-      std::swap(left, other.left);
-      std::swap(right, other.right);
-      return *this;
-    }
-    ~node() {
-      delete left;
-      delete right;
-    }
-    /* ----- ACCESSORS AND MUTATORS ----- */
-    node *insertNode(key_type key, mapped_type value) {
-      if (key < key_) {
-        if (!left) {
-          node *result = new node(key, value);
-          result->parent = this;
-          left = result;
-          return balance();
-        }
-        left = left->insertNode(key, value);
-      } else if (key > key_) {
-        if (!right) {
-          node *result = new node(key, value);
-          result->parent = this;
-          right = result;
-          return balance();
-        }
-        right = right->insertNode(key, value);
-      }
-      return balance();
-    }
+  const T &get() const { return *this; }
+  T &get() { return *this; }
+};
 
-    /* ----- TREE PRINTER ----- */
-    void copyHelper(node *src) {
-      if (src->left) {
-        left = new node(*(src->left));
-        left->parent = this;
-        left->copyHelper(src->left);
-      }
-      if (src->right) {
-        right = new node(*(src->right));
-        right->parent = this;
-        right->copyHelper(src->right);
-      }
-    };
-    void printHelper(std::string indent, bool last, int depth) const {
-      if (depth < 10) {
-        std::cout << indent;
-        if (last) {
-          std::cout << "R----";
-          indent += "     ";
-        } else {
-          std::cout << "L----";
-          indent += "|    ";
-        }
-        std::cout << "(" << key_ << ")";
-        std::cout << std::endl;
-        if (left) left->printHelper(indent, false, depth + 1);
-        if (right) right->printHelper(indent, true, depth + 1);
-      }
-    };
-    /* ----- TREE BALANCING ----- */
-    int getHeight() const { return height; }
-    int bFactor() const {
-      return (right ? right->getHeight() : 0) - (left ? left->getHeight() : 0);
-    }
-    void fixHeight() {
-      size_t hl = left ? left->getHeight() : 0;
-      size_t hr = right ? right->getHeight() : 0;
-      height = (hl > hr ? hl : hr) + 1;
-    }
-    node *rotateRight() {
-      node *result = left;
-      if (result) {
-        result->parent = parent;
-        left = result->right;
-      }
-      if (left) left->parent = this;
-      if (result) result->right = this;
-      parent = result;
-      fixHeight();
-      if (result) result->fixHeight();
-      return result;
-    }
-    node *rotateLeft() {
-      node *result = right;
-      if (result) {
-        result->parent = parent;
-        right = result->left;
-      }
-      if (right) right->parent = this;
-      if (result) result->left = this;
-      parent = result;
-      fixHeight();
-      if (result) result->fixHeight();
-      return result;
-    }
-    node *balance() {
-      fixHeight();
-      if (bFactor() == 2) {
-        if (right->bFactor() < 0) right = right->rotateRight();
-        return rotateLeft();
-      }
-      if (bFactor() == -2) {
-        if (left->bFactor() > 0) left = left->rotateLeft();
-        return rotateRight();
-      }
-      return this;
-    }
+template <typename T, int Index>
+class emptyBaseHolder<T, Index, false> {
+ public:
+  emptyBaseHolder() = default;
+  explicit emptyBaseHolder(const T &value) : value_(value) {}
+
+  const T &get() const { return value_; }
+  T &get() { return value_; }
+
+ private:
+  T value_;
+};
 
-    node *findMin() const {
-      return left ? left->findMin() : const_cast<node *>(this);
+template <typename Alloc, typename = void>
+struct hasRelease : std::false_type {};
+
+template <typename Alloc>
+struct hasRelease<Alloc,
+                  std::void_t<decltype(std::declval<Alloc &>().release())>>
+    : std::true_type {};
+
+class treeNodeBase {
+ public:
+  /* ----- PARENT AND BALANCE ----- */
+  // The balance factor (right height minus left height, -1..1) is kept
+  // in the two low bits of the parent link, which node alignment leaves
+  // free, so a node costs three words on top of its payload.
+  treeNodeBase *getParent() const {
+    return reinterpret_cast<treeNodeBase *>(parent_ & ~kBalanceMask);
+  }
+  void setParent(treeNodeBase *parent) {
+    parent_ = reinterpret_cast<uintptr_t>(parent) | (parent_ & kBalanceMask);
+  }
+  int getBalance() const {
+    return static_cast<int>(parent_ & kBalanceMask) - 1;
+  }
+  void setBalance(int balance) {
+    parent_ = (parent_ & ~kBalanceMask) | static_cast<uintptr_t>(balance + 1);
+  }
+
+  // Hooks for augmented node bases, which hide them with their own.
+  void copyState(const treeNodeBase &other) {
+    setBalance(other.getBalance());
+  }
+  static void afterRotate(treeNodeBase *, treeNodeBase *) {}
+
+  /* ----- TREE BALANCING ----- */
+  // Rotations relink the parent's child pointer as well; every node in a
+  // tree has a parent because the root hangs off the header. Base names
+  // the node base whose afterRotate hook repairs augmented data.
+  template <typename Base = treeNodeBase>
+  treeNodeBase *rotateLeft() {
+    treeNodeBase *pivot = right;
+    treeNodeBase *parent = getParent();
+    right = pivot->left;
+    if (right) right->setParent(this);
+    pivot->left = this;
+    pivot->setParent(parent);
+    setParent(pivot);
+    if (parent->left == this) {
+      parent->left = pivot;
+    } else {
+      parent->right = pivot;
     }
-    node *findMax() const {
-      return right ? right->findMax() : const_cast<node *>(this);
+    Base::afterRotate(this, pivot);
+    return pivot;
+  }
+  template <typename Base = treeNodeBase>
+  treeNodeBase *rotateRight() {
+    treeNodeBase *pivot = left;
+    treeNodeBase *parent = getParent();
+    left = pivot->right;
+    if (left) left->setParent(this);
+    pivot->right = this;
+    pivot->setParent(parent);
+    setParent(pivot);
+    if (parent->left == this) {
+      parent->left = pivot;
+    } else {
+      parent->right = pivot;
     }
-    node *removeMin() {
-      if (!left) {
-        if (right) right->parent = parent;
-        return right;
-      }
-      left = left->removeMin();
-      return balance();
-    }
-    node *removeNode(key_type key) {
-      if (key < key_) {
-        if (!left) return this;
-        left = left->removeNode(key);
-      } else if (key > key_) {
-        if (!right) return this;
-        right = right->removeNode(key);
-      } else {
-        if (!right) {
-          node *result = left;
-          if (result) result->parent = parent;
-          left = nullptr;
-          right = nullptr;
-          parent = nullptr;
-          delete this;
-          return result ? result->balance() : nullptr;
-        }
-        node *min = right->findMin();
-        min->right = right->removeMin();
-        min->left = left;
-        min->parent = parent;
-        if (min->left) min->left->parent = min;
-        if (min->right) min->right->parent = min;
-        left = nullptr;
-        right = nullptr;
-        parent = nullptr;
-        delete this;
-        return min->balance();
-      }
-      return balance();
-    }
-    size_t countNodes() const {
-      if (left && right) {
-        return 1 + left->countNodes() + right->countNodes();
-      } else if (left) {
-        return 1 + left->countNodes();
-      } else if (right) {
-        return 1 + right->countNodes();
+    Base::afterRotate(this, pivot);
+    return pivot;
+  }
+  // Called when the left subtree became two levels taller than the right
+  // one. Returns the new subtree root, whose balance is non-zero only if
+  // the subtree kept its height.
+  template <typename Base = treeNodeBase>
+  treeNodeBase *fixLeftHeavy() {
+    treeNodeBase *child = left;
+    if (child->getBalance() <= 0) {
+      rotateRight<Base>();
+      if (child->getBalance() == 0) {
+        setBalance(-1);
+        child->setBalance(1);
       } else {
-        return 1;
+        setBalance(0);
+        child->setBalance(0);
       }
+      return child;
     }
-    node *find(key_type key) const {
-      if (key < key_) {
-        if (!left) return nullptr;
-        return left->find(key);
-      } else if (key > key_) {
-        if (!right) return nullptr;
-        return right->find(key);
+    treeNodeBase *grandchild = child->right;
+    int balance = grandchild->getBalance();
+    child->template rotateLeft<Base>();
+    rotateRight<Base>();
+    setBalance(balance == -1 ? 1 : 0);
+    child->setBalance(balance == 1 ? -1 : 0);
+    grandchild->setBalance(0);
+    return grandchild;
+  }
+  template <typename Base = treeNodeBase>
+  treeNodeBase *fixRightHeavy() {
+    treeNodeBase *child = right;
+    if (child->getBalance() >= 0) {
+      rotateLeft<Base>();
+      if (child->getBalance() == 0) {
+        setBalance(1);
+        child->setBalance(-1);
       } else {
-        node *this_ = const_cast<node *>(this);
-        return this_;
+        setBalance(0);
+        child->setBalance(0);
       }
+      return child;
     }
-    node *findNext() const {
-      node *this_ = const_cast<node *>(this);
-      if (this_->right) return this_->right->findMin();
-      if (this_->parent) {
-        while (this_->parent && this_->parent->key_ < key_)
-          this_ = this_->parent;
-        if (!this_->parent) return nullptr;
-        return this_->parent;
-      }
-      return nullptr;
-    }
-    node *findPrev() const {
-      node *this_ = const_cast<node *>(this);
-      if (this_->left) return this_->left->findMax();
-      if (this_->parent) {
-        while (this_->parent && this_->parent->key_ > key_)
-          this_ = this_->parent;
-        if (!this_->parent) return nullptr;
-        return this_->parent;
+    treeNodeBase *grandchild = child->left;
+    int balance = grandchild->getBalance();
+    child->template rotateRight<Base>();
+    rotateLeft<Base>();
+    setBalance(balance == 1 ? -1 : 0);
+    child->setBalance(balance == -1 ? 1 : 0);
+    grandchild->setBalance(0);
+    return grandchild;
+  }
+
+  /* ----- TRAVERSAL ----- */
+  treeNodeBase *findMin() const {
+    treeNodeBase *this_ = const_cast<treeNodeBase *>(this);
+    while (this_->left) this_ = this_->left;
+    return this_;
+  }
+  treeNodeBase *findMax() const {
+    treeNodeBase *this_ = const_cast<treeNodeBase *>(this);
+    while (this_->right) this_ = this_->right;
+    return this_;
+  }
+  treeNodeBase *findNext() const {
+    treeNodeBase *this_ = const_cast<treeNodeBase *>(this);
+    if (this_->right) return this_->right->findMin();
+    while (this_->getParent() && this_->getParent()->right == this_)
+      this_ = this_->getParent();
+    return this_->getParent();
+  }
+  treeNodeBase *findPrev() const {
+    treeNodeBase *this_ = const_cast<treeNodeBase *>(this);
+    if (this_->left) return this_->left->findMax();
+    while (this_->getParent() && this_->getParent()->left == this_)
+      this_ = this_->getParent();
+    return this_->getParent();
+  }
+  size_t countNodes() const {
+    size_t result = 1;
+    const treeNodeBase *last = findMax();
+    for (const treeNodeBase *it = findMin(); it != last; it = it->findNext())
+      ++result;
+    return result;
+  }
+
+  treeNodeBase *left = nullptr;
+  treeNodeBase *right = nullptr;
+
+ private:
+  static constexpr uintptr_t kBalanceMask = 3;
+
+  uintptr_t parent_ = 1;
+};
+
+// Node base for order-statistic trees: size_ counts the nodes of the
+// subtree rooted here, which costs one more word per node.
+class countedNodeBase : public treeNodeBase {
+ public:
+  static size_t sizeOf(const treeNodeBase *root) {
+    return root ? static_cast<const countedNodeBase *>(root)->size_ : 0;
+  }
+  void copyState(const countedNodeBase &other) {
+    treeNodeBase::copyState(other);
+    size_ = other.size_;
+  }
+  static void afterRotate(treeNodeBase *old_root, treeNodeBase *pivot) {
+    countedNodeBase *lowered = static_cast<countedNodeBase *>(old_root);
+    static_cast<countedNodeBase *>(pivot)->size_ = lowered->size_;
+    lowered->size_ = 1 + sizeOf(lowered->left) + sizeOf(lowered->right);
+  }
+
+  size_t size_ = 1;
+};
+
+// Keeps forwarding node constructors from hijacking node copies.
+template <typename... Args>
+struct isNodeArg : std::false_type {};
+template <typename Arg>
+struct isNodeArg<Arg>
+    : std::is_base_of<treeNodeBase, typename std::decay<Arg>::type> {};
+
+template <typename K, typename V = void, typename Base = treeNodeBase>
+class treeNode;
+
+// Key-only node, used as is by set and as the base of key/value nodes.
+template <typename K, typename Base>
+class treeNode<K, void, Base> : public Base {
+ public:
+  using key_type = K;
+  using node = treeNode<K, void, Base>;
+
+  /* ----- CONSTRUCTORS AND DESTRUCTORS ----- */
+  template <typename... Args,
+            typename = std::enable_if_t<!isNodeArg<Args...>::value>>
+  explicit treeNode(Args &&...args) : key_(std::forward<Args>(args)...) {}
+  treeNode(const node &other) : key_(other.key_) { this->copyState(other); };
+  node &operator=(const node &other) = delete;
+
+  /* ----- TREE PRINTER ----- */
+  void printHelper(std::string indent, bool last, int depth) const {
+    if (depth < 10) {
+      std::cout << indent;
+      if (last) {
+        std::cout << "R----";
+        indent += "     ";
+      } else {
+        std::cout << "L----";
+        indent += "|    ";
       }
-      return nullptr;
+      std::cout << "(" << key_ << ")";
+      std::cout << std::endl;
+      if (this->left)
+        static_cast<const node *>(this->left)
+            ->printHelper(indent, false, depth + 1);
+      if (this->right)
+        static_cast<const node *>(this->right)
+            ->printHelper(indent, true, depth + 1);
     }
+  };
+
+  bool operator==(const node &other) const { return key_ == other.key_; }
+  bool operator!=(const node &other) const { return key_ != other.key_; }
+
+  const key_type key_;
+};
+
+template <typename K, typename V, typename Base>
+class treeNode : public treeNode<K, void, Base> {
+ public:
+  using key_type = K;
+  using mapped_type = V;
+  using node = treeNode<K, V, Base>;
+  using key_node = treeNode<K, void, Base>;
+
+  /* ----- CONSTRUCTORS AND DESTRUCTORS ----- */
+  template <typename Key, typename... Args,
+            typename =
+                std::enable_if_t<std::is_constructible<key_type, Key>::value>>
+  treeNode(Key &&key, Args &&...args)
+      : key_node(std::forward<Key>(key)),
+        value_(std::forward<Args>(args)...) {}
+  template <typename First, typename Second>
+  explicit treeNode(const std::pair<First, Second> &value)
+      : key_node(value.first), value_(value.second) {}
+  template <typename First, typename Second>
+  explicit treeNode(std::pair<First, Second> &&value)
+      : key_node(std::forward<First>(value.first)),
+        value_(std::forward<Second>(value.second)) {}
+  treeNode(const node &other) : key_node(other), value_(other.value_){};
+  node &operator=(const node &other) = delete;
+
+  bool operator==(const node &other) const {
+    return this->key_ == other.key_ && value_ == other.value_;
+  }
+  bool operator!=(const node &other) const {
+    return this->key_ != other.key_ || value_ != other.value_;
+  }
+
+  mapped_type value_;
+};
 
-    bool operator==(const node &other) const {
-      return key_ == other.key_ && value_ == other.value_;
+template <typename K, typename V, typename Compare, typename Allocator,
+          bool Ranked>
+class Tree;
+
+// Owns a node taken out of a tree until it is linked into another one
+// or dropped. The handle frees the node with a copy of the tree's
+// allocator, so with an allocator whose copies cannot free each other's
+// memory it must not outlive the tree it came from.
+template <typename Node, typename NodeAllocator>
+class treeNodeHandle {
+ public:
+  using key_type = typename Node::key_type;
+  using allocator_type = NodeAllocator;
+
+  // CONSTRUCTORS AND DESTRUCTOR
+  treeNodeHandle() = default;
+  treeNodeHandle(treeNodeHandle &&other) noexcept
+      : node_(other.node_), alloc_(std::move(other.alloc_)) {
+    other.node_ = nullptr;
+    other.alloc_.reset();
+  }
+  treeNodeHandle &operator=(treeNodeHandle &&other) noexcept {
+    if (this != &other) {
+      reset();
+      node_ = other.node_;
+      alloc_ = std::move(other.alloc_);
+      other.node_ = nullptr;
+      other.alloc_.reset();
     }
-    bool operator!=(const node &other) const {
-      return key_ != other.key_ || value_ != other.value_;
+    return *this;
+  }
+  ~treeNodeHandle() { reset(); }
+
+  // ACCESSORS
+  bool empty() const { return !node_; }
+  explicit operator bool() const { return node_; }
+  const key_type &key() const { return node_->key_; }
+  template <typename N = Node>
+  typename N::mapped_type &mapped() const {
+    return node_->value_;
+  }
+  allocator_type get_allocator() const { return *alloc_; }
+
+ private:
+  using traits = std::allocator_traits<NodeAllocator>;
+
+  treeNodeHandle(Node *node, const NodeAllocator &alloc)
+      : node_(node), alloc_(alloc) {}
+
+  Node *release() {
+    Node *result = node_;
+    node_ = nullptr;
+    alloc_.reset();
+    return result;
+  }
+  void reset() {
+    if (node_) {
+      traits::destroy(*alloc_, node_);
+      traits::deallocate(*alloc_, node_, 1);
+      node_ = nullptr;
     }
+    alloc_.reset();
+  }
 
-    const key_type key_;
-    mapped_type value_;
-    size_t height = 0;
-    node *left = nullptr;
-    node *right = nullptr;
-    node *parent = nullptr;
-  };
+  template <typename, typename, typename, typename, bool>
+  friend class Tree;
+
+  Node *node_ = nullptr;
+  std::optional<NodeAllocator> alloc_;
+};
+
+template <typename Iterator, typename NodeType>
+struct treeInsertReturn {
+  Iterator position;
+  bool inserted;
+  NodeType node;
+};
+
+template <typename K, typename V, typename Compare = std::less<K>,
+          typename Allocator = std::allocator<typename std::conditional<
+              std::is_void<V>::value, K, std::pair<const K, V>>::type>,
+          bool Ranked = false>
+class Tree
+    : private emptyBaseHolder<Compare, 0>,
+      private emptyBaseHolder<
+          typename std::allocator_traits<Allocator>::template rebind_alloc<
+              treeNode<K, V,
+                       typename std::conditional<Ranked, countedNodeBase,
+                                                 treeNodeBase>::type>>,
+          1> {
+ public:
+  using key_type = K;
+  using mapped_type = V;
+  using key_compare = Compare;
+  using value_type =
+      typename std::conditional<std::is_void<V>::value, key_type,
+                                std::pair<const key_type, mapped_type>>::type;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+  using nodeBase = treeNodeBase;
+  // Ranked trees keep subtree sizes for rank and select in O(log n).
+  using augment_base =
+      typename std::conditional<Ranked, countedNodeBase, treeNodeBase>::type;
+  using node = treeNode<K, V, augment_base>;
+  using node_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+  using node_type = treeNodeHandle<node, node_allocator>;
+  using compare_holder = emptyBaseHolder<Compare, 0>;
+  using allocator_holder = emptyBaseHolder<node_allocator, 1>;
 
   template <typename T>
   class treeIterator {
@@ -257,32 +430,33 @@ class Tree {
     using difference_type = int32_t;
     using pointer = T *;
     using reference = T &;
+    using base_pointer =
+        typename std::conditional<std::is_const<T>::value, const nodeBase *,
+                                  nodeBase *>::type;
 
-    treeIterator() : ptr_(nullptr), prev_(nullptr), next_(nullptr){};
-    treeIterator(T *ptr) : ptr_(ptr) {
-      if (ptr_) {
-        prev_ = ptr_->findPrev();
-        next_ = ptr_->findNext();
-      }
-    };
-    treeIterator(const treeIterator &other)
-        : ptr_(other.ptr_), prev_(other.prev_), next_(other.next_){};
+    treeIterator() : ptr_(nullptr){};
+    treeIterator(base_pointer ptr) : ptr_(ptr){};
+    treeIterator(const treeIterator &other) : ptr_(other.ptr_){};
+    treeIterator &operator=(const treeIterator &other) = default;
 
-    // treeIterator operator=(treeIterator other) : ptr_(other.ptr_),
-    // prev_(other.prev_), next_(other.next_) {};
     treeIterator &operator++() {
-      prev_ = ptr_;
-      ptr_ = next_;
-      if (next_) next_ = next_->findNext();
+      ptr_ = ptr_->findNext();
       return *this;
     }
-
     treeIterator &operator--() {
-      next_ = ptr_;
-      ptr_ = prev_;
-      if (prev_) prev_ = prev_->findPrev();
+      ptr_ = ptr_->findPrev();
       return *this;
     }
+    treeIterator operator++(int) {
+      treeIterator ret_it(*this);
+      ++(*this);
+      return ret_it;
+    }
+    treeIterator operator--(int) {
+      treeIterator ret_it(*this);
+      --(*this);
+      return ret_it;
+    }
 
     bool operator==(const treeIterator &other) const {
       return ptr_ == other.ptr_;
@@ -291,17 +465,15 @@ class Tree {
       return ptr_ != other.ptr_;
     }
 
-    T &operator*() const { return *ptr_; }
-    T *operator->() const { return ptr_; }
+    T &operator*() const { return *static_cast<T *>(ptr_); }
+    T *operator->() const { return static_cast<T *>(ptr_); }
 
     operator treeIterator<const T>() const {
-      return treeIterator<const T>(ptr_, prev_, next_);
+      return treeIterator<const T>(ptr_);
     }
 
    protected:
-    T *ptr_;
-    T *prev_;
-    T *next_;
+    base_pointer ptr_;
   };
 
   template <typename T>
@@ -314,9 +486,10 @@ class Tree {
     using difference_type = int32_t;
     using pointer = T *;
     using reference = T &;
+    using base_pointer = typename base::base_pointer;
 
     treeKeyIterator() : base(){};
-    treeKeyIterator(T *ptr) : base(ptr){};
+    treeKeyIterator(base_pointer ptr) : base(ptr){};
 
     treeKeyIterator &operator++() {
       base::operator++();
@@ -327,12 +500,12 @@ class Tree {
       return *this;
     }
 
-    treeKeyIterator &operator++(int) {
+    treeKeyIterator operator++(int) {
       treeKeyIterator ret_it(*this);
       base::operator++();
       return ret_it;
     }
-    treeKeyIterator &operator--(int) {
+    treeKeyIterator operator--(int) {
       treeKeyIterator ret_it(*this);
       base::operator--();
       return ret_it;
@@ -345,14 +518,12 @@ class Tree {
       return base::ptr_ != other.ptr_;
     }
 
-    typename std::conditional<std::is_const<T>::value, mapped_type,
-                              mapped_type &>::type
-    operator*() {
-      return base::ptr_->value_;
+    const key_type &operator*() const {
+      return static_cast<T *>(base::ptr_)->key_;
     }
 
     operator treeKeyIterator<const T>() const {
-      return treeKeyIterator<const T>(base::ptr_, base::prev_, base::next_);
+      return treeKeyIterator<const T>(base::ptr_);
     }
   };
 
@@ -362,13 +533,24 @@ class Tree {
   using const_key_iterator = treeKeyIterator<const node>;
 
   // CONSTRUCTORS AND DESTRUCTOR
-  Tree() : root_(nullptr), count_(0){};
-  Tree(key_type key, mapped_type value)
-      : root_(new node(key, value)), count_(1){};
+  Tree() : count_(0){};
+  explicit Tree(const Compare &comp, const Allocator &alloc = Allocator())
+      : compare_holder(comp), allocator_holder(node_allocator(alloc)),
+        count_(0){};
+  // Takes the node allocator as is, without a round trip through
+  // Allocator, for trees built to receive another tree's nodes.
+  Tree(const Compare &comp, const node_allocator &alloc)
+      : compare_holder(comp), allocator_holder(alloc), count_(0){};
+  template <typename... Args>
+  Tree(const key_type &key, Args &&...args) : count_(1) {
+    setRoot(createNode(key, std::forward<Args>(args)...));
+  };
   Tree(const Tree &other)
-      : root_(new node(other.root_->key_, other.root_->value_)),
+      : compare_holder(other.key_comp()),
+        allocator_holder(node_traits::select_on_container_copy_construction(
+            other.nodeAllocator())),
         count_(other.count_) {
-    root_->copyHelper(other.root_);
+    setRoot(cloneSubtree(other.root()));
   }
   Tree(Tree &&other) : Tree() { *this = std::move(other); }
   Tree &operator=(const Tree &other) {
@@ -377,84 +559,807 @@ class Tree {
     return *this;
   }
   Tree &operator=(Tree &&other) {
-    std::swap(root_, other.root_);
+    std::swap(compare_holder::get(), other.compare_holder::get());
+    std::swap(nodeAllocator(), other.nodeAllocator());
     std::swap(count_, other.count_);
+    node *root = other.root();
+    other.setRoot(this->root());
+    setRoot(root);
     return *this;
   }
 
-  ~Tree() { delete root_; };
+  ~Tree() { clear(); };
 
   // MAIN FUNCTIONS
-  void insert(key_type key, mapped_type value) {
-    if (root_) {
-      root_ = root_->insertNode(key, value);
-      count_ = root_->countNodes();
+  // The node is built only after the descent finds a free slot, so a
+  // duplicate key never allocates or touches args.
+  template <typename... Args>
+  std::pair<node *, bool> insertUnique(const key_type &key, Args &&...args) {
+    nodeBase *parent;
+    bool to_left;
+    if (node *found = findSlot(key, parent, to_left))
+      return std::make_pair(found, false);
+    node *result = createNode(key, std::forward<Args>(args)...);
+    linkNode(result, parent, to_left);
+    return std::make_pair(result, true);
+  }
+  template <typename... Args>
+  std::pair<node *, bool> insertUnique(key_type &&key, Args &&...args) {
+    nodeBase *parent;
+    bool to_left;
+    if (node *found = findSlot(key, parent, to_left))
+      return std::make_pair(found, false);
+    node *result = createNode(std::move(key), std::forward<Args>(args)...);
+    linkNode(result, parent, to_left);
+    return std::make_pair(result, true);
+  }
+  // Builds the node first since the key is only known once it exists;
+  // the node is dropped again if the key is already present.
+  template <typename... Args>
+  std::pair<node *, bool> emplaceUnique(Args &&...args) {
+    return insertNode(createNode(std::forward<Args>(args)...));
+  }
+  // Links target into the tree, or destroys it if its key is taken.
+  std::pair<node *, bool> insertNode(node *target) {
+    nodeBase *parent;
+    bool to_left;
+    if (node *found = findSlot(keyOf(target), parent, to_left)) {
+      destroyNode(target);
+      return std::make_pair(found, false);
+    }
+    linkNode(target, parent, to_left);
+    return std::make_pair(target, true);
+  }
+  // Always links a new node, after any nodes with an equivalent key, so
+  // equal keys keep their insertion order.
+  template <typename... Args>
+  node *insertEqual(Args &&...args) {
+    node *result = createNode(std::forward<Args>(args)...);
+    linkEqual(result);
+    return result;
+  }
+  // On an empty tree the sorted prefix of [first, last) is linked as a
+  // perfectly balanced tree in O(n), skipping equivalent neighbours.
+  // Whatever is left (or everything, for a non-empty tree) is inserted
+  // one element at a time.
+  template <typename InputIt>
+  void insertSorted(InputIt first, InputIt last) {
+    if (!count_) first = buildSorted(first, last);
+    for (; first != last; ++first) insertNode(createNode(*first));
+  }
+  template <typename... Args>
+  bool insert(const key_type &key, Args &&...args) {
+    return insertUnique(key, std::forward<Args>(args)...).second;
+  }
+  bool remove(const key_type &key) {
+    node *target = findNode(key);
+    if (!target) return false;
+    eraseNode(target);
+    return true;
+  }
+  void erase(iterator pos) {
+    if (pos != end()) eraseNode(&*pos);
+  }
+  void clear() {
+    if constexpr (std::is_trivially_destructible<node>::value &&
+                  hasRelease<node_allocator>::value) {
+      // A pool shared with a node handle or another tree is not dropped.
+      if (!nodeAllocator().release()) destroySubtree(root());
     } else {
-      root_ = new node(key, value);
-      count_ = 1;
+      destroySubtree(root());
     }
+    header_.left = nullptr;
+    count_ = 0;
+  }
+
+  /* ----- NODE HANDLES ----- */
+  node_type extract(iterator pos) {
+    if (pos == end()) return node_type();
+    node *target = &*pos;
+    unlinkNode(target);
+    return node_type(target, nodeAllocator());
   }
-  void remove(key_type key) {
-    root_ = root_->removeNode(key);
-    if (root_) {
-      count_ = root_->countNodes();
+  // Relinks the handle's node, or copies it if this tree cannot free it.
+  // On a duplicate key the handle keeps its node and the holder of the
+  // key is returned.
+  std::pair<node *, bool> insertHandle(node_type &handle) {
+    nodeBase *parent;
+    bool to_left;
+    if (node *found = findSlot(handle.key(), parent, to_left))
+      return std::make_pair(found, false);
+    node *target;
+    if (node_traits::is_always_equal::value ||
+        *handle.alloc_ == nodeAllocator()) {
+      target = handle.release();
     } else {
-      count_ = 0;
+      target = createNode(static_cast<const node &>(*handle.node_));
+      handle.reset();
     }
+    linkNode(target, parent, to_left);
+    return std::make_pair(target, true);
   }
-  size_type count() const { return root_ ? root_->countNodes() : 0; }
-  size_type size() const { return count(); }
-  node *findNode(key_type key) const {
-    return root_ ? root_->find(key) : nullptr;
+
+  /* ----- MERGING ----- */
+  // Moves over the nodes of other whose keys are missing here; the rest
+  // stay in other. Nodes are relinked rather than copied whenever the
+  // two trees can free each other's nodes.
+  void merge(Tree &other) {
+    if (&other == this) return;
+    nodeBase *current = other.leftmost();
+    while (current != &other.header_) {
+      nodeBase *next = current->findNext();
+      nodeBase *parent;
+      bool to_left;
+      if (!findSlot(keyOf(current), parent, to_left)) {
+        node *source = static_cast<node *>(current);
+        node *moved = source;
+        if (sharesNodes(other)) {
+          other.unlinkNode(source);
+        } else {
+          moved = createNode(static_cast<const node &>(*source));
+          other.eraseNode(source);
+        }
+        linkNode(moved, parent, to_left);
+      }
+      current = next;
+    }
+  }
+  // Moves over every node of other, each after the equivalent keys
+  // already here, and leaves other empty.
+  void mergeEqual(Tree &other) {
+    if (&other == this) return;
+    nodeBase *current = other.leftmost();
+    while (current != &other.header_) {
+      nodeBase *next = current->findNext();
+      node *source = static_cast<node *>(current);
+      node *moved = source;
+      if (sharesNodes(other)) {
+        other.unlinkNode(source);
+      } else {
+        moved = createNode(static_cast<const node &>(*source));
+        other.eraseNode(source);
+      }
+      linkEqual(moved);
+      current = next;
+    }
+  }
+  // Copies the keys found only here, in both trees, or only in other,
+  // as selected, in one pass over both trees and O(n + m) overall.
+  Tree combine(const Tree &other, bool only_this, bool both,
+               bool only_other) const {
+    Tree result(key_comp(), node_traits::select_on_container_copy_construction(
+                                nodeAllocator()));
+    std::vector<nodeBase *> nodes;
+    const nodeBase *lhs = leftmost();
+    const nodeBase *rhs = other.leftmost();
+    try {
+      while (lhs != &header_ || rhs != &other.header_) {
+        const nodeBase *source = nullptr;
+        if (rhs == &other.header_ ||
+            (lhs != &header_ && key_comp()(keyOf(lhs), keyOf(rhs)))) {
+          if (only_this) source = lhs;
+          lhs = lhs->findNext();
+        } else if (lhs == &header_ || key_comp()(keyOf(rhs), keyOf(lhs))) {
+          if (only_other) source = rhs;
+          rhs = rhs->findNext();
+        } else {
+          if (both) source = lhs;
+          lhs = lhs->findNext();
+          rhs = rhs->findNext();
+        }
+        if (source) {
+          nodes.push_back(nullptr);
+          nodes.back() =
+              result.createNode(*static_cast<const node *>(source));
+        }
+      }
+    } catch (...) {
+      for (nodeBase *current : nodes)
+        if (current) result.destroyNode(static_cast<node *>(current));
+      throw;
+    }
+    result.setRoot(buildBalanced(nodes.data(), nodes.size()));
+    result.count_ = nodes.size();
+    return result;
   }
 
-  // ITERATORS FUNCTIONS
+  /* ----- SPLIT AND JOIN ----- */
+  // Removes [first, last) by splitting it out and joining the remaining
+  // halves, in O(k + log n) for k removed elements. Returns k.
+  size_type erase(iterator first, iterator last) {
+    if (first == last) return 0;
+    nodeBase *lhs, *middle, *rhs;
+    int lh, mh, rh;
+    splitSubtree(header_.left, heightOf(header_.left), keyOf(&*first), lhs,
+                 lh, middle, mh);
+    if (last != end()) {
+      splitSubtree(middle, mh, keyOf(&*last), middle, mh, rhs, rh);
+    } else {
+      rhs = nullptr;
+      rh = 0;
+    }
+    setRoot(concat(lhs, lh, rhs, rh, lh));
+    size_type result = destroySubtree(middle);
+    count_ -= result;
+    return result;
+  }
+  // Moves every key not ordered before key into the returned tree in
+  // O(log n). Unranked trees count the moved part, which is linear in
+  // its size.
+  Tree split(const key_type &key) {
+    Tree result(key_comp(), nodeAllocator());
+    nodeBase *lhs, *rhs;
+    int lh, rh;
+    splitSubtree(header_.left, heightOf(header_.left), key, lhs, lh, rhs, rh);
+    setRoot(lhs);
+    result.setRoot(rhs);
+    size_type moved = result.countSubtree(rhs);
+    count_ -= moved;
+    result.count_ = moved;
+    if (!sharesNodes(result)) {
+      result.setRoot(nullptr);
+      result.count_ = 0;
+      try {
+        result.setRoot(result.cloneSubtree(rhs));
+      } catch (...) {
+        setRoot(concat(header_.left, heightOf(header_.left), rhs, rh, lh));
+        count_ += moved;
+        throw;
+      }
+      result.count_ = moved;
+      destroySubtree(rhs);
+    }
+    return result;
+  }
+  // Appends other, whose keys must all be ordered after this tree's, in
+  // O(log n) and leaves it empty.
+  void join(Tree &other) {
+    if (!other.count_) return;
+    if (count_ && !key_comp()(keyOf(header_.left->findMax()),
+                              keyOf(other.header_.left->findMin())))
+      throw std::invalid_argument("Tree::join: key ranges overlap");
+    size_type moved = other.count_;
+    nodeBase *rhs;
+    if (sharesNodes(other)) {
+      rhs = other.header_.left;
+      other.setRoot(nullptr);
+      other.count_ = 0;
+    } else {
+      rhs = cloneSubtree(other.header_.left);
+      other.clear();
+    }
+    int height;
+    setRoot(concat(header_.left, heightOf(header_.left), rhs, heightOf(rhs),
+                   height));
+    count_ += moved;
+  }
+  size_type count() const { return count_; }
+  size_type size() const { return count_; }
+  node *findNode(const key_type &key) const { return lookup(key); }
+  template <typename L, typename C = Compare,
+            typename = typename C::is_transparent>
+  node *findNode(const L &key) const {
+    return lookup(key);
+  }
 
-  iterator begin() {
-    if (root_) return iterator(root_->findMin());
-    return end();
+  /* ----- BOUNDS ----- */
+  // Each bound is one descent; the header stands for end(). Callers
+  // gate heterogeneous keys on Compare::is_transparent.
+  template <typename L>
+  nodeBase *lowerBound(const L &key) const {
+    const nodeBase *result = &header_;
+    const nodeBase *current = header_.left;
+    while (current) {
+      if (!key_comp()(keyOf(current), key)) {
+        result = current;
+        current = current->left;
+      } else {
+        current = current->right;
+      }
+    }
+    return const_cast<nodeBase *>(result);
+  }
+  template <typename L>
+  nodeBase *upperBound(const L &key) const {
+    const nodeBase *result = &header_;
+    const nodeBase *current = header_.left;
+    while (current) {
+      if (key_comp()(key, keyOf(current))) {
+        result = current;
+        current = current->left;
+      } else {
+        current = current->right;
+      }
+    }
+    return const_cast<nodeBase *>(result);
   }
-  iterator end() {
-    if (root_) return iterator(root_->findMax());
-    return iterator();
+  // Keys are unique, so the upper end is at most one step past the
+  // lower one.
+  template <typename L>
+  std::pair<nodeBase *, nodeBase *> equalRange(const L &key) const {
+    nodeBase *lower = lowerBound(key);
+    nodeBase *upper = lower;
+    if (lower != &header_ && !key_comp()(key, keyOf(lower)))
+      upper = lower->findNext();
+    return std::make_pair(lower, upper);
   }
 
-  const_iterator begin() const {
-    if (root_) return const_iterator(root_->findMin());
-    return end();
+  /* ----- ORDER STATISTICS ----- */
+  // The node at position k in key order, or nullptr if k >= size().
+  node *selectNode(size_type k) const {
+    static_assert(Ranked, "selectNode needs a ranked tree");
+    const nodeBase *current = header_.left;
+    while (current) {
+      size_type left_size = augment_base::sizeOf(current->left);
+      if (k < left_size) {
+        current = current->left;
+      } else if (k == left_size) {
+        return static_cast<node *>(const_cast<nodeBase *>(current));
+      } else {
+        k -= left_size + 1;
+        current = current->right;
+      }
+    }
+    return nullptr;
   }
-  const_iterator end() const {
-    if (root_) return ++const_iterator(root_->findMax());
-    return const_iterator();
+  // Number of keys ordered before key.
+  size_type rank(const key_type &key) const {
+    static_assert(Ranked, "rank needs a ranked tree");
+    size_type result = 0;
+    const nodeBase *current = header_.left;
+    while (current) {
+      if (key_comp()(keyOf(current), key)) {
+        result += augment_base::sizeOf(current->left) + 1;
+        current = current->right;
+      } else {
+        current = current->left;
+      }
+    }
+    return result;
+  }
+  // Number of keys in [lo, hi).
+  size_type countRange(const key_type &lo, const key_type &hi) const {
+    return key_comp()(lo, hi) ? rank(hi) - rank(lo) : 0;
   }
 
-  key_iterator kbegin() {
-    if (root_) return key_iterator(root_->findMin());
-    return kend();
+  const key_compare &key_comp() const { return compare_holder::get(); }
+  node_allocator &nodeAllocator() { return allocator_holder::get(); }
+  const node_allocator &nodeAllocator() const {
+    return allocator_holder::get();
   }
-  key_iterator kend() {
-    if (root_) return key_iterator(root_->findMax());
-    return key_iterator();
+  node *root() const { return static_cast<node *>(header_.left); }
+
+  // ITERATORS FUNCTIONS
+
+  iterator begin() { return iterator(leftmost()); }
+  iterator end() { return iterator(&header_); }
+
+  const_iterator begin() const { return const_iterator(leftmost()); }
+  const_iterator end() const { return const_iterator(&header_); }
+
+  key_iterator kbegin() { return key_iterator(leftmost()); }
+  key_iterator kend() { return key_iterator(&header_); }
+
+  const_key_iterator kbegin() const { return const_key_iterator(leftmost()); }
+  const_key_iterator kend() const { return const_key_iterator(&header_); }
+
+  // HELPER FUNCTIONS
+
+  template <typename L>
+  node *lookup(const L &key) const {
+    const nodeBase *current = header_.left;
+    while (current) {
+      if (key_comp()(key, keyOf(current))) {
+        current = current->left;
+      } else if (key_comp()(keyOf(current), key)) {
+        current = current->right;
+      } else {
+        return static_cast<node *>(const_cast<nodeBase *>(current));
+      }
+    }
+    return nullptr;
   }
 
-  const_key_iterator kbegin() const {
-    if (root_) return const_key_iterator(root_->findMin());
-    return kend();
+  // Returns the node holding key, or nullptr after pointing parent and
+  // to_left at the empty link where key belongs.
+  node *findSlot(const key_type &key, nodeBase *&parent, bool &to_left) {
+    parent = &header_;
+    to_left = true;
+    nodeBase *current = header_.left;
+    while (current) {
+      parent = current;
+      if (key_comp()(key, keyOf(current))) {
+        to_left = true;
+        current = current->left;
+      } else if (key_comp()(keyOf(current), key)) {
+        to_left = false;
+        current = current->right;
+      } else {
+        return static_cast<node *>(current);
+      }
+    }
+    return nullptr;
   }
-  const_key_iterator kend() const {
-    if (root_) return ++const_key_iterator(root_->findMax());
-    return const_key_iterator();
+  // Links target below the last node whose key is not ordered after it.
+  void linkEqual(node *target) {
+    nodeBase *parent = &header_;
+    bool to_left = true;
+    for (nodeBase *current = header_.left; current;) {
+      parent = current;
+      to_left = key_comp()(keyOf(target), keyOf(current));
+      current = to_left ? current->left : current->right;
+    }
+    linkNode(target, parent, to_left);
+  }
+  template <typename InputIt>
+  InputIt buildSorted(InputIt first, InputIt last) {
+    std::vector<nodeBase *> nodes;
+    node *stray = nullptr;
+    try {
+      for (; first != last && !stray; ++first) {
+        nodes.push_back(nullptr);
+        node *current = createNode(*first);
+        nodes.back() = current;
+        if (nodes.size() == 1) continue;
+        const key_type &prev = keyOf(nodes[nodes.size() - 2]);
+        if (key_comp()(prev, keyOf(current))) continue;
+        bool out_of_order = key_comp()(keyOf(current), prev);
+        nodes.pop_back();
+        if (out_of_order) {
+          stray = current;
+        } else {
+          destroyNode(current);
+        }
+      }
+    } catch (...) {
+      for (nodeBase *current : nodes)
+        if (current) destroyNode(static_cast<node *>(current));
+      if (stray) destroyNode(stray);
+      throw;
+    }
+    setRoot(buildBalanced(nodes.data(), nodes.size()));
+    count_ = nodes.size();
+    if (stray) insertNode(stray);
+    return first;
+  }
+  // The middle node becomes the root and the left half gets the extra
+  // node, so every subtree of n nodes is bitWidth(n) levels high.
+  static nodeBase *buildBalanced(nodeBase *const *nodes, size_t size) {
+    if (!size) return nullptr;
+    size_t mid = size / 2;
+    nodeBase *root = nodes[mid];
+    root->left = buildBalanced(nodes, mid);
+    root->right = buildBalanced(nodes + mid + 1, size - mid - 1);
+    if (root->left) root->left->setParent(root);
+    if (root->right) root->right->setParent(root);
+    root->setBalance(bitWidth(size - mid - 1) - bitWidth(mid));
+    if constexpr (Ranked) static_cast<augment_base *>(root)->size_ = size;
+    return root;
   }
 
-  // HELPER FUNCTIONS
+  // Split and join work on detached subtrees whose heights are passed
+  // along, so no node needs to store its height.
+  static int heightOf(const nodeBase *root) {
+    int result = 0;
+    for (; root; ++result)
+      root = root->getBalance() < 0 ? root->left : root->right;
+    return result;
+  }
+  size_type countSubtree(const nodeBase *root) const {
+    if constexpr (Ranked) {
+      return augment_base::sizeOf(root);
+    } else {
+      return root ? root->countNodes() : 0;
+    }
+  }
+  bool sharesNodes(const Tree &other) const {
+    return node_traits::is_always_equal::value ||
+           nodeAllocator() == other.nodeAllocator();
+  }
+  static void linkChildren(nodeBase *root, nodeBase *left, nodeBase *right) {
+    root->left = left;
+    root->right = right;
+    if (left) left->setParent(root);
+    if (right) right->setParent(root);
+  }
+  // Joins lhs, mid and rhs, where lhs keys < mid key < rhs keys, and
+  // stores the height of the result. mid is hung on the spine of the
+  // taller side at the first subtree no more than one level taller than
+  // the shorter side, then rebalanced as if it had just been inserted.
+  nodeBase *joinAround(nodeBase *lhs, int lh, nodeBase *mid, nodeBase *rhs,
+                       int rh, int &height) {
+    if (lh <= rh + 1 && rh <= lh + 1) {
+      linkChildren(mid, lhs, rhs);
+      mid->setBalance(rh - lh);
+      updateSize(mid);
+      height = (lh > rh ? lh : rh) + 1;
+      return mid;
+    }
+    bool right_spine = lh > rh;
+    int spot_height = right_spine ? lh : rh;
+    int short_height = right_spine ? rh : lh;
+    nodeBase anchor;
+    anchor.left = right_spine ? lhs : rhs;
+    anchor.left->setParent(&anchor);
+    nodeBase *parent = &anchor;
+    nodeBase *spot = anchor.left;
+    while (spot_height > short_height + 1) {
+      parent = spot;
+      if (right_spine) {
+        spot_height -= spot->getBalance() < 0 ? 2 : 1;
+        spot = spot->right;
+      } else {
+        spot_height -= spot->getBalance() > 0 ? 2 : 1;
+        spot = spot->left;
+      }
+    }
+    if (right_spine) {
+      linkChildren(mid, spot, rhs);
+      mid->setBalance(rh - spot_height);
+      parent->right = mid;
+    } else {
+      linkChildren(mid, lhs, spot);
+      mid->setBalance(spot_height - lh);
+      parent->left = mid;
+    }
+    mid->setParent(parent);
+    refreshSizes(mid, &anchor);
+    bool grew = rebalanceAfterGrowth(mid, &anchor);
+    height = (right_spine ? lh : rh) + (grew ? 1 : 0);
+    return anchor.left;
+  }
+  // Joins lhs and rhs, where lhs keys < rhs keys, using the minimum of
+  // rhs as the middle node.
+  nodeBase *concat(nodeBase *lhs, int lh, nodeBase *rhs, int rh,
+                   int &height) {
+    if (!lhs || !rhs) {
+      height = lhs ? lh : rh;
+      return lhs ? lhs : rhs;
+    }
+    nodeBase anchor;
+    anchor.left = rhs;
+    rhs->setParent(&anchor);
+    nodeBase *mid = rhs->findMin();
+    nodeBase *parent = mid->getParent();
+    bool left_shorter = parent->left == mid;
+    replaceChild(parent, mid, mid->right);
+    if (mid->right) mid->right->setParent(parent);
+    refreshSizes(parent, &anchor);
+    if (rebalanceAfterErase(parent, left_shorter, &anchor)) --rh;
+    return joinAround(lhs, lh, mid, anchor.left, rh, height);
+  }
+  // Splits the detached subtree root of height h into lhs, with the keys
+  // ordered before key, and rhs with the rest. Every level joins one
+  // node back, and the join costs telescope to O(log n) overall.
+  void splitSubtree(nodeBase *root, int h, const key_type &key,
+                    nodeBase *&lhs, int &lh, nodeBase *&rhs, int &rh) {
+    if (!root) {
+      lhs = rhs = nullptr;
+      lh = rh = 0;
+      return;
+    }
+    nodeBase *left = root->left;
+    nodeBase *right = root->right;
+    int left_h = h - (root->getBalance() > 0 ? 2 : 1);
+    int right_h = h - (root->getBalance() < 0 ? 2 : 1);
+    if (key_comp()(keyOf(root), key)) {
+      splitSubtree(right, right_h, key, lhs, lh, rhs, rh);
+      lhs = joinAround(left, left_h, root, lhs, lh, lh);
+    } else {
+      splitSubtree(left, left_h, key, lhs, lh, rhs, rh);
+      rhs = joinAround(rhs, rh, root, right, right_h, rh);
+    }
+  }
+  static int bitWidth(size_t value) {
+    int result = 0;
+    for (; value; value >>= 1) ++result;
+    return result;
+  }
+  // target may come from another tree, so its links are reset first.
+  void linkNode(node *target, nodeBase *parent, bool to_left) {
+    target->left = target->right = nullptr;
+    target->setBalance(0);
+    target->setParent(parent);
+    if (to_left) {
+      parent->left = target;
+    } else {
+      parent->right = target;
+    }
+    refreshSizes(target, &header_);
+    rebalanceAfterGrowth(target, &header_);
+    ++count_;
+  }
+
+  template <typename... Args>
+  node *createNode(Args &&...args) {
+    node *result = node_traits::allocate(nodeAllocator(), 1);
+    try {
+      node_traits::construct(nodeAllocator(), result,
+                             std::forward<Args>(args)...);
+    } catch (...) {
+      node_traits::deallocate(nodeAllocator(), result, 1);
+      throw;
+    }
+    return result;
+  }
+  void destroyNode(node *target) {
+    node_traits::destroy(nodeAllocator(), target);
+    node_traits::deallocate(nodeAllocator(), target, 1);
+  }
+  size_type destroySubtree(nodeBase *root) {
+    size_type result = 0;
+    while (root) {
+      if (root->left) {
+        nodeBase *left_child = root->left;
+        root->left = left_child->right;
+        left_child->right = root;
+        root = left_child;
+      } else {
+        nodeBase *next = root->right;
+        destroyNode(static_cast<node *>(root));
+        root = next;
+        ++result;
+      }
+    }
+    return result;
+  }
+  // Copies the shape and balance factors of root without recursion or a
+  // stack: both trees are walked in lockstep through parent links, and a
+  // missing child in the copy marks a subtree that is still to be cloned.
+  node *cloneSubtree(const nodeBase *root) {
+    if (!root) return nullptr;
+    node *result = createNode(*static_cast<const node *>(root));
+    const nodeBase *src = root;
+    nodeBase *dst = result;
+    try {
+      while (true) {
+        if (src->left && !dst->left) {
+          src = src->left;
+          dst->left = createNode(*static_cast<const node *>(src));
+          dst->left->setParent(dst);
+          dst = dst->left;
+        } else if (src->right && !dst->right) {
+          src = src->right;
+          dst->right = createNode(*static_cast<const node *>(src));
+          dst->right->setParent(dst);
+          dst = dst->right;
+        } else if (src != root) {
+          src = src->getParent();
+          dst = dst->getParent();
+        } else {
+          break;
+        }
+      }
+    } catch (...) {
+      destroySubtree(result);
+      throw;
+    }
+    return result;
+  }
+
+  static const key_type &keyOf(const nodeBase *current) {
+    return static_cast<const node *>(current)->key_;
+  }
+  nodeBase *leftmost() const {
+    const nodeBase *result = header_.left ? header_.left->findMin() : &header_;
+    return const_cast<nodeBase *>(result);
+  }
+  void setRoot(nodeBase *root) {
+    header_.left = root;
+    if (root) root->setParent(&header_);
+  }
+  void replaceChild(nodeBase *parent, nodeBase *old_child,
+                    nodeBase *new_child) {
+    if (parent->left == old_child) {
+      parent->left = new_child;
+    } else {
+      parent->right = new_child;
+    }
+  }
+  // Grows or shrinks the subtree sizes on the way from current up to the
+  // root; rotations afterwards repair the nodes they move.
+  static void updateSize(nodeBase *current) {
+    if constexpr (Ranked) {
+      static_cast<augment_base *>(current)->size_ =
+          1 + augment_base::sizeOf(current->left) +
+          augment_base::sizeOf(current->right);
+    }
+  }
+  // Recomputes the subtree sizes from current up to, not including, top.
+  static void refreshSizes(nodeBase *current, const nodeBase *top) {
+    if constexpr (Ranked) {
+      for (; current != top; current = current->getParent())
+        updateSize(current);
+    }
+  }
+  // The rebalancing walks stop below top, the node the subtree hangs
+  // off: the header, or a local anchor while splitting and joining.
+  // They return whether the height change reached top.
+  bool rebalanceAfterGrowth(nodeBase *current, const nodeBase *top) {
+    nodeBase *parent = current->getParent();
+    while (parent != top) {
+      int balance = parent->getBalance() + (parent->left == current ? -1 : 1);
+      if (balance == 0) {
+        parent->setBalance(0);
+        return false;
+      } else if (balance == -2 || balance == 2) {
+        // A node fixed back to balance zero has its old height again.
+        current = balance < 0 ? parent->template fixLeftHeavy<augment_base>()
+                              : parent->template fixRightHeavy<augment_base>();
+        if (current->getBalance() == 0) return false;
+      } else {
+        parent->setBalance(balance);
+        current = parent;
+      }
+      parent = current->getParent();
+    }
+    return true;
+  }
+  bool rebalanceAfterErase(nodeBase *parent, bool left_shorter,
+                           const nodeBase *top) {
+    while (parent != top) {
+      nodeBase *grand = parent->getParent();
+      bool parent_is_left = grand->left == parent;
+      int balance = parent->getBalance() + (left_shorter ? 1 : -1);
+      if (balance == 2) {
+        parent = parent->template fixRightHeavy<augment_base>();
+      } else if (balance == -2) {
+        parent = parent->template fixLeftHeavy<augment_base>();
+      } else {
+        parent->setBalance(balance);
+      }
+      if (parent->getBalance() != 0) return false;
+      left_shorter = parent_is_left;
+      parent = grand;
+    }
+    return true;
+  }
+  void eraseNode(node *target) {
+    unlinkNode(target);
+    destroyNode(target);
+  }
+  // Takes target out of the tree without destroying it.
+  void unlinkNode(node *target) {
+    nodeBase *parent = target->getParent();
+    bool left_shorter = parent->left == target;
+    if (!target->left || !target->right) {
+      nodeBase *child = target->left ? target->left : target->right;
+      if (child) child->setParent(parent);
+      replaceChild(parent, target, child);
+    } else {
+      nodeBase *min = target->right->findMin();
+      if (min->getParent() == target) {
+        parent = min;
+        left_shorter = false;
+      } else {
+        parent = min->getParent();
+        left_shorter = true;
+        parent->left = min->right;
+        if (min->right) min->right->setParent(parent);
+        min->right = target->right;
+        min->right->setParent(min);
+      }
+      min->left = target->left;
+      min->left->setParent(min);
+      min->setParent(target->getParent());
+      static_cast<augment_base *>(min)->copyState(*target);
+      replaceChild(target->getParent(), target, min);
+    }
+    refreshSizes(parent, &header_);
+    rebalanceAfterErase(parent, left_shorter, &header_);
+    --count_;
+  }
 
   void print() const {
-    if (root_) root_->printHelper("", true, 5);
+    if (root()) root()->printHelper("", true, 5);
   }
 
-  node *root_;
+  // The header is the parent of the root and the past-the-end position:
+  // the root hangs off header_.left, so stepping past the maximum lands
+  // on it and stepping back from it reaches the maximum.
+  nodeBase header_;
   size_t count_;
 };
 }  // namespace s21
 
-#endif  // CPP2_S21_CONTAINERS_SRC_CONTAINERS_TREE_H_
\ No newline at end of file
+#endif  // CPP2_S21_CONTAINERS_SRC_CONTAINERS_TREE_H_
@@ -0,0 +1,150 @@
+#ifndef CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_UNORDERED_MAP_H_
+#define CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_UNORDERED_MAP_H_
+
+#include <initializer_list>
+#include <limits>
+#include <stdexcept>
+
+#include "hash_table.h"
+
+namespace s21 {
+// map on a robin hood hash table; see HashTable. Same interface as map
+// minus the ordered lookups, plus reserve() and the load factor.
+template <typename K, typename V, typename Hash = std::hash<K>,
+          typename KeyEqual = std::equal_to<K>,
+          typename Allocator = std::allocator<std::pair<const K, V>>>
+class unordered_map {
+ public:
+  using table = HashTable<K, V, Hash, KeyEqual, Allocator>;
+  using key_type = K;
+  using mapped_type = V;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using allocator_type = Allocator;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using iterator = typename table::template hashIterator<mapped_type>;
+  using const_iterator =
+      typename table::template hashIterator<const mapped_type>;
+  using size_type = size_t;
+
+  // CONSTRUCTORS
+  unordered_map() = default;
+  explicit unordered_map(const Hash &hash, const KeyEqual &equal = KeyEqual(),
+                         const Allocator &alloc = Allocator())
+      : table_(hash, equal, alloc) {}
+  unordered_map(std::initializer_list<value_type> const &items)
+      : table_() {
+    table_.reserve(items.size());
+    for (const value_type &item : items) insert(item);
+  }
+  unordered_map(const unordered_map &other) : table_(other.table_) {}
+  unordered_map(unordered_map &&other) : table_(std::move(other.table_)) {}
+
+  // DESTRUCTOR
+  ~unordered_map() = default;
+
+  // OVERLOAD OPERATORS
+  unordered_map &operator=(const unordered_map &other) {
+    table_ = other.table_;
+    return *this;
+  }
+  unordered_map &operator=(unordered_map &&other) {
+    table_ = std::move(other.table_);
+    return *this;
+  }
+  mapped_type &operator[](const key_type &key) {
+    return table_.insertUnique(key).first->value_;
+  }
+
+  mapped_type &at(const key_type &key) {
+    iterator res = find(key);
+    if (res == end()) throw std::out_of_range("Key does not exist");
+    return res->value_;
+  }
+  const mapped_type &at(const key_type &key) const {
+    const_iterator res = find(key);
+    if (res == end()) throw std::out_of_range("Key does not exist");
+    return res->value_;
+  }
+
+  // ITERATORS
+  iterator begin() { return table_.template begin<mapped_type>(); }
+  const_iterator begin() const {
+    return table_.template begin<const mapped_type>();
+  }
+  iterator end() { return table_.template end<mapped_type>(); }
+  const_iterator end() const {
+    return table_.template end<const mapped_type>();
+  }
+
+  // MAIN FUNCTIONS
+  bool empty() const { return !table_.size(); }
+  size_type size() const { return table_.size(); }
+  size_type max_size() const {
+    return std::numeric_limits<std::ptrdiff_t>::max() /
+           (sizeof(key_type) + sizeof(mapped_type) + 1);
+  }
+  hasher hash_function() const { return table_.hash_function(); }
+  key_equal key_eq() const { return table_.key_eq(); }
+  allocator_type get_allocator() const { return table_.get_allocator(); }
+
+  // HASH POLICY
+  size_type bucket_count() const { return table_.capacity(); }
+  float load_factor() const {
+    return table_.capacity() ? static_cast<float>(table_.size()) /
+                                   static_cast<float>(table_.capacity())
+                             : 0.0f;
+  }
+  // The table grows once it would pass this load.
+  float max_load_factor() const { return 0.875f; }
+  void reserve(size_type count) { table_.reserve(count); }
+
+  iterator find(const key_type &key) {
+    return table_.template find<mapped_type>(key);
+  }
+  const_iterator find(const key_type &key) const {
+    return table_.template find<const mapped_type>(key);
+  }
+  bool contains(const key_type &key) const { return find(key) != end(); }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return table_.insertUnique(value.first, value.second);
+  }
+  std::pair<iterator, bool> insert(const key_type &key,
+                                   const mapped_type &obj) {
+    return table_.insertUnique(key, obj);
+  }
+  std::pair<iterator, bool> insert_or_assign(const key_type &key,
+                                             const mapped_type &obj) {
+    auto res = table_.insertUnique(key, obj);
+    if (!res.second) res.first->value_ = obj;
+    return res;
+  }
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const key_type &key, Args &&...args) {
+    return table_.insertUnique(key, std::forward<Args>(args)...);
+  }
+
+  void erase(iterator pos) { table_.erase(pos); }
+  size_type erase(const key_type &key) { return table_.erase(key); }
+  void swap(unordered_map &other) { table_.swap(other.table_); }
+  void clear() { table_.clear(); }
+  // Moves in the entries of other whose keys are missing here; the rest
+  // stay in other.
+  void merge(unordered_map &other) {
+    if (this == &other) return;
+    table rest(other.table_.hash_function(), other.table_.key_eq(),
+               other.table_.get_allocator());
+    for (iterator it = other.begin(); it != other.end(); ++it) {
+      if (!table_.insertUnique(it->key_, std::move(it->value_)).second) {
+        rest.insertUnique(it->key_, std::move(it->value_));
+      }
+    }
+    other.table_ = std::move(rest);
+  }
+
+ private:
+  table table_;
+};
+}  // namespace s21
+#endif  // CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_UNORDERED_MAP_H_
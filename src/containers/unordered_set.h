@@ -0,0 +1,107 @@
+#ifndef CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_UNORDERED_SET_H_
+#define CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_UNORDERED_SET_H_
+
+#include <initializer_list>
+#include <limits>
+
+#include "hash_table.h"
+
+namespace s21 {
+// set on a robin hood hash table; see HashTable. Same interface as set
+// minus the ordered lookups, plus reserve() and the load factor.
+template <typename T, typename Hash = std::hash<T>,
+          typename KeyEqual = std::equal_to<T>,
+          typename Allocator = std::allocator<T>>
+class unordered_set {
+ public:
+  using table = HashTable<T, void, Hash, KeyEqual, Allocator>;
+  using key_type = T;
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using allocator_type = Allocator;
+  using iterator = typename table::template hashIterator<void>;
+  using const_iterator = iterator;
+  using size_type = size_t;
+
+  // CONSTRUCTORS
+  unordered_set() = default;
+  explicit unordered_set(const Hash &hash, const KeyEqual &equal = KeyEqual(),
+                         const Allocator &alloc = Allocator())
+      : table_(hash, equal, alloc) {}
+  unordered_set(std::initializer_list<value_type> const &items) : table_() {
+    table_.reserve(items.size());
+    for (const value_type &item : items) insert(item);
+  }
+  unordered_set(const unordered_set &other) : table_(other.table_) {}
+  unordered_set(unordered_set &&other) : table_(std::move(other.table_)) {}
+
+  // DESTRUCTOR
+  ~unordered_set() = default;
+
+  // OVERLOAD OPERATORS
+  unordered_set &operator=(const unordered_set &other) {
+    table_ = other.table_;
+    return *this;
+  }
+  unordered_set &operator=(unordered_set &&other) {
+    table_ = std::move(other.table_);
+    return *this;
+  }
+
+  // ITERATORS
+  iterator begin() const { return table_.template begin<void>(); }
+  iterator end() const { return table_.template end<void>(); }
+
+  // MAIN FUNCTIONS
+  bool empty() const { return !table_.size(); }
+  size_type size() const { return table_.size(); }
+  size_type max_size() const {
+    return std::numeric_limits<std::ptrdiff_t>::max() /
+           (sizeof(key_type) + 1);
+  }
+  hasher hash_function() const { return table_.hash_function(); }
+  key_equal key_eq() const { return table_.key_eq(); }
+  allocator_type get_allocator() const { return table_.get_allocator(); }
+
+  // HASH POLICY
+  size_type bucket_count() const { return table_.capacity(); }
+  float load_factor() const {
+    return table_.capacity() ? static_cast<float>(table_.size()) /
+                                   static_cast<float>(table_.capacity())
+                             : 0.0f;
+  }
+  // The table grows once it would pass this load.
+  float max_load_factor() const { return 0.875f; }
+  void reserve(size_type count) { table_.reserve(count); }
+
+  iterator find(const key_type &key) const {
+    return table_.template find<void>(key);
+  }
+  bool contains(const key_type &key) const { return find(key) != end(); }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return table_.insertUnique(value);
+  }
+  void erase(iterator pos) { table_.erase(pos); }
+  size_type erase(const key_type &key) { return table_.erase(key); }
+  void swap(unordered_set &other) { table_.swap(other.table_); }
+  void clear() { table_.clear(); }
+  // Moves in the keys of other missing here; the rest stay in other.
+  void merge(unordered_set &other) {
+    if (this == &other) return;
+    table rest(other.table_.hash_function(), other.table_.key_eq(),
+               other.table_.get_allocator());
+    for (iterator it = other.begin(); it != other.end(); ++it) {
+      if (!table_.insertUnique(*it).second) rest.insertUnique(*it);
+    }
+    other.table_ = std::move(rest);
+  }
+
+ private:
+  table table_;
+};
+}  // namespace s21
+#endif  // CPP2_S21_CONTAINERS_1_SRC_CONTAINERS_UNORDERED_SET_H_
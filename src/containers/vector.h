@@ -43,17 +43,18 @@ class Vector {
   const_reference front();
   const_reference back();
   T *data();
+  const T *data() const;
 
   // iterators
   iterator begin();
   iterator end();
 
   // capacity
-  bool empty();
-  size_type size();
+  bool empty() const;
+  size_type size() const;
   size_type max_size();
   void reserve(size_type size);
-  size_type capacity();
+  size_type capacity() const;
   void shrink_to_fit();
 
   // modifiers
@@ -61,6 +62,7 @@ class Vector {
   iterator insert(iterator pos, const_reference value);
   void erase(const iterator pos);
   void push_back(const_reference value);
+  void push_back(value_type &&value);
   void pop_back();
   void swap(Vector &other);
 };
@@ -83,12 +85,12 @@ s21::Vector<T>::Vector(size_type n) {
 }
 
 template <typename T>
-size_t s21::Vector<T>::size() {
+size_t s21::Vector<T>::size() const {
   return size_;
 }
 
 template <typename T>
-size_t s21::Vector<T>::capacity() {
+size_t s21::Vector<T>::capacity() const {
   return capacity_;
 }
 
@@ -114,7 +116,7 @@ template <typename T>
 s21::Vector<T>::Vector(const Vector &v)
     : size_(v.size_), capacity_(v.capacity_) {
   if (this->arr_ == nullptr) {
-    arr_ = new value_type[size_];
+    arr_ = new value_type[capacity_];
   }
   for (size_t i = 0; i < v.size_; i++) arr_[i] = v.arr_[i];
 };
@@ -164,7 +166,7 @@ const T &s21::Vector<T>::back() {
 }
 
 template <typename T>
-bool s21::Vector<T>::empty() {
+bool s21::Vector<T>::empty() const {
   bool result = true;
   if (size_ != 0) result = false;
   return result;
@@ -175,6 +177,11 @@ T *s21::Vector<T>::data() {
   return arr_;
 }
 
+template <typename T>
+const T *s21::Vector<T>::data() const {
+  return arr_;
+}
+
 template <typename T>
 size_t s21::Vector<T>::max_size() {
   return std::numeric_limits<size_type>::max() / sizeof(value_type) / 2;
@@ -195,6 +202,14 @@ void s21::Vector<T>::push_back(const T &v) {
   arr_[size_++] = v;
 }
 
+template <typename T>
+void s21::Vector<T>::push_back(T &&v) {
+  if (size_ == capacity_) {
+    reserve(size_ + 1);
+  }
+  arr_[size_++] = std::move(v);
+}
+
 template <typename T>
 void s21::Vector<T>::reserve(size_type size) {
   if (size > capacity_) {
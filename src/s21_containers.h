@@ -1,12 +1,27 @@
 #ifndef CPP2_S21_CONTAINERS_SRC_HEADER_H
 #define CPP2_S21_CONTAINERS_SRC_HEADER_H
 
+#include "containers/btree.h"
+#include "containers/btree_map.h"
+#include "containers/btree_set.h"
+#include "containers/concurrent_map.h"
+#include "containers/flat_map.h"
+#include "containers/flat_set.h"
+#include "containers/frozen_set.h"
+#include "containers/hash_table.h"
 #include "containers/list.h"
 #include "containers/map.h"
+#include "containers/multimap.h"
+#include "containers/multiset.h"
+#include "containers/persistent_map.h"
+#include "containers/pool_allocator.h"
 #include "containers/queue.h"
 #include "containers/set.h"
+#include "containers/sharded_map.h"
 #include "containers/stack.h"
 #include "containers/tree.h"
+#include "containers/unordered_map.h"
+#include "containers/unordered_set.h"
 #include "containers/vector.h"
 
 #endif
\ No newline at end of file
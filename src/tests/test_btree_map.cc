@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../s21_containers.h"
+
+// 64-byte nodes hold four entries, so small inputs already build trees
+// several levels deep.
+using small_map = s21::btree_map<int, int, std::less<int>, 64>;
+
+template <typename Map, typename Ref>
+void sameContents(const Map &m, const Ref &ref) {
+  ASSERT_EQ(m.size(), ref.size());
+  auto it = m.begin();
+  for (const auto &item : ref) {
+    EXPECT_EQ(it->key_, item.first);
+    EXPECT_EQ(it->value_, item.second);
+    ++it;
+  }
+  EXPECT_TRUE(it == m.end());
+}
+
+// TEST CONSTRUCTORS
+
+TEST(btree_map_constructor, case1) {
+  s21::btree_map<int, std::string> m;
+  EXPECT_TRUE(m.empty());
+  EXPECT_EQ(m.height(), 0U);
+  EXPECT_TRUE(m.begin() == m.end());
+  EXPECT_TRUE(m.find(1) == m.end());
+  EXPECT_EQ(m.erase(1), 0U);
+}
+
+TEST(btree_map_constructor, case2) {
+  s21::btree_map<int, std::string, std::less<int>, 64> m{
+      {3, "c"}, {1, "a"}, {2, "b"}, {1, "x"}, {5, "e"}, {4, "d"}};
+  sameContents(m, std::map<int, std::string>{
+                      {1, "a"}, {2, "b"}, {3, "c"}, {4, "d"}, {5, "e"}});
+  auto copy = m;
+  auto moved = std::move(m);
+  EXPECT_TRUE(m.empty());
+  copy[1] = "z";
+  EXPECT_EQ(moved.at(1), "a");
+  EXPECT_EQ(copy.at(1), "z");
+  m = copy;
+  EXPECT_EQ(m.size(), 5U);
+  EXPECT_THROW(m.at(9), std::out_of_range);
+}
+
+// TEST MODIFIERS
+
+TEST(btree_map_insert, case1) {
+  std::mt19937 gen(17);
+  std::uniform_int_distribution<int> dist(0, 3000);
+  small_map m;
+  std::map<int, int> ref;
+  for (int i = 0; i < 5000; ++i) {
+    int key = dist(gen);
+    auto res = m.insert(key, i);
+    EXPECT_EQ(res.second, ref.insert({key, i}).second);
+    EXPECT_EQ(res.first->key_, key);
+    EXPECT_EQ(res.first->value_, ref[key]);
+  }
+  sameContents(m, ref);
+  EXPECT_GT(m.height(), 3U);
+}
+
+TEST(btree_map_insert, case2) {
+  s21::btree_map<std::string, int> m;
+  m["b"] = 1;
+  m["a"] += 2;
+  EXPECT_FALSE(m.insert_or_assign("b", 5).second);
+  EXPECT_TRUE(m.try_emplace("c", 7).second);
+  EXPECT_FALSE(m.try_emplace("c", 8).second);
+  sameContents(m, std::map<std::string, int>{{"a", 2}, {"b", 5}, {"c", 7}});
+}
+
+TEST(btree_map_erase, case1) {
+  std::mt19937 gen(23);
+  std::uniform_int_distribution<int> dist(0, 999);
+  small_map m;
+  std::map<int, int> ref;
+  for (int i = 0; i < 1000; ++i) {
+    m.insert(i, -i);
+    ref.insert({i, -i});
+  }
+  for (int i = 0; i < 3000; ++i) {
+    int key = dist(gen);
+    EXPECT_EQ(m.erase(key), ref.erase(key));
+    if (i % 3 == 0) {
+      m.insert(key, key);
+      ref.insert({key, key});
+    }
+  }
+  sameContents(m, ref);
+  for (int i = 0; i < 1000; ++i) {
+    auto it = m.find(i);
+    if (it != m.end()) m.erase(it);
+  }
+  EXPECT_TRUE(m.empty());
+  EXPECT_EQ(m.height(), 0U);
+  m.insert(1, 1);
+  EXPECT_EQ(m.size(), 1U);
+}
+
+TEST(btree_map_erase, case2) {
+  using shared_map =
+      s21::btree_map<int, std::shared_ptr<int>, std::less<int>, 64>;
+  std::vector<std::shared_ptr<int>> values;
+  shared_map m;
+  for (int i = 0; i < 200; ++i) {
+    values.push_back(std::make_shared<int>(i));
+    m.insert(i, values.back());
+  }
+  std::vector<int> order(200);
+  for (int i = 0; i < 200; ++i) order[i] = i;
+  std::shuffle(order.begin(), order.end(), std::mt19937(5));
+  for (size_t i = 0; i < order.size(); ++i) {
+    m.erase(order[i]);
+    EXPECT_EQ(values[order[i]].use_count(), 1);
+    if (i + 1 < order.size()) {
+      EXPECT_EQ(values[order[i + 1]].use_count(), 2);
+    }
+  }
+  EXPECT_TRUE(m.empty());
+}
+
+// TEST ITERATION AND LOOKUP
+
+TEST(btree_map_iterator, case1) {
+  small_map m;
+  std::map<int, int> ref;
+  for (int i = 0; i < 200; i += 2) {
+    m.insert(i, i * i);
+    ref.insert({i, i * i});
+  }
+  auto it = m.end();
+  for (auto rit = ref.rbegin(); rit != ref.rend(); ++rit) {
+    --it;
+    EXPECT_EQ(it->key_, rit->first);
+  }
+  EXPECT_TRUE(it == m.begin());
+  const small_map &cm = m;
+  for (int key = -1; key <= 201; ++key) {
+    auto lo = cm.lower_bound(key);
+    auto hi = cm.upper_bound(key);
+    auto ref_lo = ref.lower_bound(key);
+    auto ref_hi = ref.upper_bound(key);
+    EXPECT_EQ(lo == cm.end(), ref_lo == ref.end());
+    EXPECT_EQ(hi == cm.end(), ref_hi == ref.end());
+    if (ref_lo != ref.end()) {
+      EXPECT_EQ(lo->key_, ref_lo->first);
+    }
+    if (ref_hi != ref.end()) {
+      EXPECT_EQ(hi->key_, ref_hi->first);
+    }
+  }
+}
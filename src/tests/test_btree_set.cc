@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <set>
+#include <string>
+
+#include "../s21_containers.h"
+
+using small_set = s21::btree_set<int, std::less<int>, 64>;
+
+template <typename Set, typename Ref>
+void sameKeys(const Set &s, const Ref &ref) {
+  ASSERT_EQ(s.size(), ref.size());
+  EXPECT_TRUE(std::equal(ref.begin(), ref.end(), s.begin()));
+}
+
+TEST(btree_set_constructor, case1) {
+  s21::btree_set<std::string> s{"world", "hello", "!", "hello"};
+  sameKeys(s, std::set<std::string>{"world", "hello", "!"});
+  s21::btree_set<std::string> copy(s);
+  s.clear();
+  EXPECT_TRUE(s.empty());
+  EXPECT_EQ(copy.size(), 3U);
+  EXPECT_TRUE(copy.contains("!"));
+}
+
+TEST(btree_set_insert, case1) {
+  std::mt19937 gen(29);
+  std::uniform_int_distribution<int> dist(-2000, 2000);
+  small_set s;
+  std::set<int> ref;
+  for (int round = 0; round < 4; ++round) {
+    for (int i = 0; i < 3000; ++i) {
+      int key = dist(gen);
+      auto res = s.insert(key);
+      EXPECT_EQ(res.second, ref.insert(key).second);
+      EXPECT_EQ(*res.first, key);
+    }
+    sameKeys(s, ref);
+    for (int i = 0; i < 3000; ++i) {
+      int key = dist(gen);
+      EXPECT_EQ(s.erase(key), ref.erase(key));
+    }
+    sameKeys(s, ref);
+    small_set copy(s);
+    sameKeys(copy, ref);
+  }
+}
+
+TEST(btree_set_lookup, case1) {
+  small_set s;
+  for (int i = 0; i < 100; i += 5) s.insert(i);
+  EXPECT_EQ(*s.lower_bound(12), 15);
+  EXPECT_EQ(*s.upper_bound(15), 20);
+  EXPECT_TRUE(s.lower_bound(96) == s.end());
+  EXPECT_TRUE(s.find(12) == s.end());
+  EXPECT_EQ(*s.find(95), 95);
+  s.erase(s.find(95));
+  EXPECT_FALSE(s.contains(95));
+  EXPECT_EQ(*--s.end(), 90);
+}
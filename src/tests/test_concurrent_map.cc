@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_containers.h"
+
+// Tracks how many values are alive to check that old versions are freed.
+struct LiveValue {
+  static std::atomic<int> alive;
+  int value = 0;
+
+  LiveValue() { ++alive; }
+  explicit LiveValue(int v) : value(v) { ++alive; }
+  LiveValue(const LiveValue &other) : value(other.value) { ++alive; }
+  LiveValue &operator=(const LiveValue &other) = default;
+  ~LiveValue() { --alive; }
+};
+std::atomic<int> LiveValue::alive{0};
+
+// TEST SINGLE THREAD
+
+TEST(concurrent_map_basic, case1) {
+  s21::concurrent_map<std::string, int> m;
+  s21::concurrent_map<std::string, int>::reader r(m);
+  EXPECT_EQ(r.size(), 0U);
+  EXPECT_TRUE(m.insert("a", 1));
+  EXPECT_FALSE(m.insert("a", 2));
+  EXPECT_FALSE(m.insert_or_assign("a", 3));
+  EXPECT_TRUE(m.insert_or_assign("b", 4));
+  EXPECT_TRUE(r.contains("a"));
+  EXPECT_EQ(*r.find("a"), 3);
+  EXPECT_FALSE(r.find("c").has_value());
+  auto snap = m.snapshot();
+  EXPECT_EQ(m.erase("a"), 1U);
+  EXPECT_EQ(m.erase("a"), 0U);
+  EXPECT_FALSE(r.contains("a"));
+  EXPECT_TRUE(snap.contains("a"));
+  EXPECT_EQ(r.size(), 1U);
+}
+
+TEST(concurrent_map_basic, case2) {
+  using small_map = s21::concurrent_map<int, int, std::less<int>, 2>;
+  small_map m;
+  small_map::reader first(m);
+  {
+    small_map::reader second(m);
+    EXPECT_THROW(small_map::reader third(m), std::runtime_error);
+  }
+  small_map::reader third(m);
+  EXPECT_FALSE(third.contains(0));
+}
+
+TEST(concurrent_map_basic, case3) {
+  {
+    s21::concurrent_map<int, LiveValue> m;
+    for (int i = 0; i < 1000; ++i) m.insert_or_assign(i % 100, LiveValue(i));
+    EXPECT_EQ(LiveValue::alive.load(), 100);
+  }
+  EXPECT_EQ(LiveValue::alive.load(), 0);
+}
+
+// TEST THREADS
+
+TEST(concurrent_map_threads, case1) {
+  s21::concurrent_map<int, int> m;
+  const int count = 2000;
+  std::atomic<bool> done{false};
+  std::atomic<int> errors{0};
+  std::vector<std::thread> readers;
+  for (int t = 0; t < 4; ++t) {
+    readers.emplace_back([&] {
+      s21::concurrent_map<int, int>::reader r(m);
+      size_t last_size = 0;
+      while (!done.load()) {
+        size_t size = r.size();
+        if (size < last_size) ++errors;
+        last_size = size;
+        for (int key = 0; key < count; key += 97) {
+          auto value = r.find(key);
+          if (value && *value != key * 2) ++errors;
+        }
+      }
+    });
+  }
+  for (int i = 0; i < count; ++i) m.insert(i, i * 2);
+  done = true;
+  for (std::thread &t : readers) t.join();
+  EXPECT_EQ(errors.load(), 0);
+  s21::concurrent_map<int, int>::reader r(m);
+  EXPECT_EQ(r.size(), static_cast<size_t>(count));
+}
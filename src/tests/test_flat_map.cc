@@ -0,0 +1,225 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../s21_containers.h"
+
+template <typename Flat, typename Ref>
+void sameContents(const Flat &flat, const Ref &ref) {
+  ASSERT_EQ(flat.size(), ref.size());
+  auto it = flat.begin();
+  for (const auto &item : ref) {
+    EXPECT_EQ(it->key_, item.first);
+    EXPECT_EQ(it->value_, item.second);
+    ++it;
+  }
+  EXPECT_TRUE(it == flat.end());
+}
+
+// TEST CONSTRUCTORS
+
+TEST(flat_map_constructor, case1) {
+  s21::flat_map<int, std::string> flat;
+  EXPECT_TRUE(flat.empty());
+  EXPECT_EQ(flat.size(), 0U);
+  EXPECT_TRUE(flat.begin() == flat.end());
+}
+
+TEST(flat_map_constructor, case2) {
+  s21::flat_map<int, std::string> flat{{3, "c"}, {1, "a"}, {2, "b"}, {1, "x"}};
+  std::map<int, std::string> ref{{3, "c"}, {1, "a"}, {2, "b"}, {1, "x"}};
+  sameContents(flat, ref);
+}
+
+TEST(flat_map_constructor, case3) {
+  s21::flat_map<int, int> flat{{1, 10}, {2, 20}, {3, 30}};
+  s21::flat_map<int, int> copy(flat);
+  s21::flat_map<int, int> moved(std::move(flat));
+  EXPECT_TRUE(flat.empty());
+  sameContents(copy, std::map<int, int>{{1, 10}, {2, 20}, {3, 30}});
+  sameContents(moved, std::map<int, int>{{1, 10}, {2, 20}, {3, 30}});
+  flat = copy;
+  copy[1] = 0;
+  EXPECT_EQ(flat.at(1), 10);
+}
+
+// TEST ACCESS
+
+TEST(flat_map_access, case1) {
+  s21::flat_map<std::string, int> flat;
+  flat["b"] = 2;
+  flat["a"] = 1;
+  flat["b"] += 5;
+  EXPECT_EQ(flat.at("a"), 1);
+  EXPECT_EQ(flat.at("b"), 7);
+  EXPECT_THROW(flat.at("c"), std::out_of_range);
+  EXPECT_TRUE(flat.contains("a"));
+  EXPECT_FALSE(flat.contains("c"));
+  EXPECT_TRUE(flat.find("c") == flat.end());
+  EXPECT_EQ(flat.find("b")->value_, 7);
+}
+
+// TEST MODIFIERS
+
+TEST(flat_map_insert, case1) {
+  std::mt19937 gen(7);
+  std::uniform_int_distribution<int> dist(0, 500);
+  s21::flat_map<int, int> flat;
+  std::map<int, int> ref;
+  for (int i = 0; i < 2000; ++i) {
+    int key = dist(gen);
+    auto res = flat.insert(key, i);
+    auto exp = ref.insert({key, i});
+    EXPECT_EQ(res.second, exp.second);
+    EXPECT_EQ(res.first->key_, key);
+  }
+  sameContents(flat, ref);
+}
+
+TEST(flat_map_insert, case2) {
+  s21::flat_map<int, int> flat{{1, 1}, {2, 2}};
+  auto res = flat.insert_or_assign(2, 20);
+  EXPECT_FALSE(res.second);
+  EXPECT_EQ(flat.at(2), 20);
+  res = flat.insert_or_assign(0, 0);
+  EXPECT_TRUE(res.second);
+  EXPECT_TRUE(res.first == flat.begin());
+}
+
+TEST(flat_map_insert, case3) {
+  s21::flat_map<std::string, std::unique_ptr<int>> flat;
+  std::string key = "b";
+  auto res = flat.insert(std::move(key), std::make_unique<int>(2));
+  EXPECT_TRUE(res.second);
+  EXPECT_EQ(*res.first->value_, 2);
+  res = flat.emplace("a", std::make_unique<int>(1));
+  EXPECT_TRUE(res.second);
+  EXPECT_TRUE(res.first == flat.begin());
+  std::unique_ptr<int> kept = std::make_unique<int>(3);
+  res = flat.try_emplace("a", std::move(kept));
+  EXPECT_FALSE(res.second);
+  EXPECT_TRUE(kept);
+  res = flat.insert_or_assign("a", std::move(kept));
+  EXPECT_FALSE(res.second);
+  EXPECT_EQ(*flat.at("a"), 3);
+  res = flat.try_emplace("c", new int(4));
+  EXPECT_TRUE(res.second);
+  flat["d"] = std::make_unique<int>(5);
+  EXPECT_EQ(flat.size(), 4);
+  EXPECT_EQ(*flat.at("d"), 5);
+}
+
+TEST(flat_map_erase, case1) {
+  std::mt19937 gen(11);
+  s21::flat_map<int, int> flat;
+  std::map<int, int> ref;
+  for (int i = 0; i < 300; ++i) {
+    flat.insert(i, -i);
+    ref.insert({i, -i});
+  }
+  for (int i = 0; i < 200; ++i) {
+    int key = std::uniform_int_distribution<int>(0, 299)(gen);
+    auto it = flat.find(key);
+    if (it != flat.end()) {
+      flat.erase(it);
+      ref.erase(key);
+    }
+  }
+  sameContents(flat, ref);
+}
+
+TEST(flat_map_erase, case2) {
+  s21::flat_map<int, std::string> flat;
+  for (int i = 0; i < 100; ++i) flat.insert(i, std::to_string(i));
+  EXPECT_EQ(flat.erase_range(20, 70), 50U);
+  EXPECT_EQ(flat.erase_range(70, 20), 0U);
+  EXPECT_EQ(flat.size(), 50U);
+  EXPECT_FALSE(flat.contains(20));
+  EXPECT_TRUE(flat.contains(70));
+  EXPECT_EQ(flat.at(99), "99");
+  flat.clear();
+  EXPECT_TRUE(flat.empty());
+  flat.insert(1, "1");
+  EXPECT_EQ(flat.size(), 1U);
+}
+
+TEST(flat_map_merge, case1) {
+  s21::flat_map<int, int> lhs{{1, 1}, {3, 3}, {5, 5}};
+  s21::flat_map<int, int> rhs{{2, 20}, {3, 30}, {6, 60}};
+  lhs.merge(rhs);
+  sameContents(lhs,
+               std::map<int, int>{{1, 1}, {2, 20}, {3, 3}, {5, 5}, {6, 60}});
+  sameContents(rhs, std::map<int, int>{{3, 30}});
+  s21::flat_map<int, int> other{{9, 9}};
+  lhs.swap(other);
+  EXPECT_EQ(lhs.size(), 1U);
+  EXPECT_EQ(other.size(), 5U);
+}
+
+// TEST SORTED BATCHES
+
+TEST(flat_map_sorted, case1) {
+  std::vector<std::pair<int, int>> batch;
+  for (int i = 0; i < 1000; i += 2) batch.emplace_back(i, i);
+  auto flat = s21::flat_map<int, int>::from_sorted(batch.begin(), batch.end());
+  std::map<int, int> ref(batch.begin(), batch.end());
+  sameContents(flat, ref);
+
+  std::vector<std::pair<int, int>> more;
+  for (int i = 0; i < 1000; i += 3) more.emplace_back(i, -i);
+  more.emplace_back(1000, 1);
+  more.emplace_back(1000, 2);
+  flat.insert_sorted(more.begin(), more.end());
+  ref.insert(more.begin(), more.end());
+  sameContents(flat, ref);
+}
+
+TEST(flat_map_sorted, case2) {
+  std::vector<std::pair<int, int>> batch{{1, 1}, {5, 5}, {3, 3}, {2, 2}};
+  s21::flat_map<int, int> flat{{2, 20}};
+  flat.insert_sorted(batch.begin(), batch.end());
+  sameContents(flat, std::map<int, int>{{1, 1}, {2, 20}, {3, 3}, {5, 5}});
+}
+
+// TEST RANGE LOOKUP
+
+TEST(flat_map_bounds, case1) {
+  s21::flat_map<int, int> flat;
+  std::map<int, int> ref;
+  for (int i = 0; i < 64; i += 4) {
+    flat.insert(i, i);
+    ref.insert({i, i});
+  }
+  const auto &cflat = flat;
+  for (int key = -2; key < 70; ++key) {
+    auto lo = ref.lower_bound(key);
+    auto hi = ref.upper_bound(key);
+    EXPECT_EQ(std::distance(ref.begin(), lo),
+              flat.lower_bound(key) - flat.begin());
+    EXPECT_EQ(std::distance(ref.begin(), hi),
+              flat.upper_bound(key) - flat.begin());
+    auto range = cflat.equal_range(key);
+    EXPECT_EQ(std::distance(lo, hi), range.second - range.first);
+  }
+}
+
+TEST(flat_map_bounds, case2) {
+  s21::flat_map<std::string, int, std::less<>> flat{
+      {"apple", 1}, {"cherry", 3}, {"banana", 2}};
+  std::string_view key = "banana";
+  EXPECT_TRUE(flat.contains(key));
+  EXPECT_EQ(flat.find(key)->value_, 2);
+  EXPECT_EQ(flat.at(key), 2);
+  EXPECT_TRUE(flat.find(std::string_view("kiwi")) == flat.end());
+  EXPECT_EQ(flat.lower_bound(std::string_view("b")) - flat.begin(), 1);
+  EXPECT_EQ(flat.upper_bound(key) - flat.begin(), 2);
+  auto range = flat.equal_range(key);
+  EXPECT_EQ(range.second - range.first, 1);
+}
@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../s21_containers.h"
+
+template <typename Flat, typename Ref>
+void sameKeys(const Flat &flat, const Ref &ref) {
+  ASSERT_EQ(flat.size(), ref.size());
+  EXPECT_TRUE(std::equal(ref.begin(), ref.end(), flat.begin()));
+}
+
+// TEST CONSTRUCTORS
+
+TEST(flat_set_constructor, case1) {
+  s21::flat_set<std::string> flat{"world", "hello", "!", "hello"};
+  sameKeys(flat, std::set<std::string>{"world", "hello", "!"});
+  s21::flat_set<std::string> copy(flat);
+  s21::flat_set<std::string> moved(std::move(flat));
+  EXPECT_TRUE(flat.empty());
+  sameKeys(copy, moved);
+  flat = copy;
+  copy.clear();
+  EXPECT_EQ(flat.size(), 3U);
+  EXPECT_TRUE(copy.empty());
+}
+
+// TEST MODIFIERS
+
+TEST(flat_set_insert, case1) {
+  std::mt19937 gen(3);
+  std::uniform_int_distribution<int> dist(-300, 300);
+  s21::flat_set<int> flat;
+  std::set<int> ref;
+  for (int i = 0; i < 2000; ++i) {
+    int key = dist(gen);
+    auto res = flat.insert(key);
+    EXPECT_EQ(res.second, ref.insert(key).second);
+    EXPECT_EQ(*res.first, key);
+  }
+  sameKeys(flat, ref);
+  for (int i = 0; i < 1000; ++i) {
+    int key = dist(gen);
+    auto it = flat.find(key);
+    EXPECT_EQ(it != flat.end(), ref.count(key) == 1);
+    if (it != flat.end()) {
+      flat.erase(it);
+      ref.erase(key);
+    }
+  }
+  sameKeys(flat, ref);
+}
+
+TEST(flat_set_insert, case2) {
+  s21::flat_set<std::string> flat;
+  std::string key(32, 'b');
+  EXPECT_TRUE(flat.insert(std::move(key)).second);
+  EXPECT_TRUE(key.empty());
+  auto res = flat.emplace(32, 'a');
+  EXPECT_TRUE(res.second);
+  EXPECT_TRUE(res.first == flat.begin());
+  EXPECT_FALSE(flat.emplace(32, 'b').second);
+  EXPECT_EQ(flat.size(), 2);
+}
+
+TEST(flat_set_erase, case1) {
+  s21::flat_set<int> flat;
+  for (int i = 0; i < 100; ++i) flat.insert(i);
+  EXPECT_EQ(flat.erase_range(10, 90), 80U);
+  EXPECT_EQ(flat.erase_range(5, 5), 0U);
+  EXPECT_EQ(flat.size(), 20U);
+  EXPECT_TRUE(flat.contains(9));
+  EXPECT_FALSE(flat.contains(10));
+  EXPECT_TRUE(flat.contains(90));
+}
+
+TEST(flat_set_merge, case1) {
+  s21::flat_set<int> lhs{1, 3, 5};
+  s21::flat_set<int> rhs{0, 3, 4, 9};
+  lhs.merge(rhs);
+  sameKeys(lhs, std::set<int>{0, 1, 3, 4, 5, 9});
+  sameKeys(rhs, std::set<int>{3});
+}
+
+// TEST SORTED BATCHES
+
+TEST(flat_set_sorted, case1) {
+  std::vector<int> batch;
+  for (int i = 0; i < 1000; i += 2) batch.push_back(i);
+  auto flat = s21::flat_set<int>::from_sorted(batch.begin(), batch.end());
+  std::set<int> ref(batch.begin(), batch.end());
+  sameKeys(flat, ref);
+
+  std::vector<int> more{-5, -5, 1, 2, 3, 999, 1001, 7, -10};
+  flat.insert_sorted(more.begin(), more.end());
+  ref.insert(more.begin(), more.end());
+  sameKeys(flat, ref);
+}
+
+// TEST RANGE LOOKUP
+
+TEST(flat_set_bounds, case1) {
+  for (int count = 0; count < 40; ++count) {
+    s21::flat_set<int> flat;
+    std::set<int> ref;
+    for (int i = 0; i < count; ++i) {
+      flat.insert(i * 3);
+      ref.insert(i * 3);
+    }
+    for (int key = -1; key <= count * 3; ++key) {
+      EXPECT_EQ(std::distance(ref.begin(), ref.lower_bound(key)),
+                flat.lower_bound(key) - flat.begin());
+      EXPECT_EQ(std::distance(ref.begin(), ref.upper_bound(key)),
+                flat.upper_bound(key) - flat.begin());
+    }
+  }
+}
+
+TEST(flat_set_bounds, case2) {
+  s21::flat_set<std::string, std::less<>> flat{"apple", "cherry", "banana"};
+  std::string_view key = "banana";
+  EXPECT_TRUE(flat.contains(key));
+  EXPECT_EQ(*flat.find(key), "banana");
+  EXPECT_TRUE(flat.find(std::string_view("kiwi")) == flat.end());
+  EXPECT_EQ(flat.lower_bound(std::string_view("b")) - flat.begin(), 1);
+  EXPECT_EQ(flat.upper_bound(key) - flat.begin(), 2);
+  auto range = flat.equal_range(key);
+  EXPECT_EQ(range.second - range.first, 1);
+}
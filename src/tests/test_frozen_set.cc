@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "../s21_containers.h"
+
+// TEST FREEZE
+
+TEST(frozen_set_freeze, case1) {
+  s21::set<int> s;
+  s21::frozen_set<int> empty = s.freeze();
+  EXPECT_TRUE(empty.empty());
+  EXPECT_TRUE(empty.begin() == empty.end());
+  EXPECT_FALSE(empty.contains(0));
+  EXPECT_TRUE(empty.lower_bound(0) == empty.end());
+}
+
+TEST(frozen_set_freeze, case2) {
+  for (int count = 1; count < 70; ++count) {
+    s21::set<int> s;
+    for (int i = 0; i < count; ++i) s.insert(i * 2);
+    s21::frozen_set<int> frozen = s.freeze();
+    ASSERT_EQ(frozen.size(), s.size());
+    EXPECT_TRUE(std::equal(s.begin(), s.end(), frozen.begin()));
+
+    std::vector<int> backwards;
+    for (auto it = frozen.end(); it != frozen.begin();) {
+      backwards.push_back(*--it);
+    }
+    EXPECT_TRUE(std::equal(backwards.rbegin(), backwards.rend(), s.begin()));
+  }
+}
+
+TEST(frozen_set_freeze, case3) {
+  s21::set<std::string> s{"pear", "apple", "fig", "kiwi"};
+  auto frozen = s.freeze();
+  s.clear();
+  EXPECT_EQ(frozen.size(), 4U);
+  EXPECT_EQ(*frozen.begin(), "apple");
+  EXPECT_TRUE(frozen.contains("kiwi"));
+  EXPECT_FALSE(frozen.contains("plum"));
+  s21::frozen_set<std::string> copy(frozen);
+  s21::frozen_set<std::string> moved(std::move(frozen));
+  EXPECT_TRUE(frozen.empty());
+  EXPECT_TRUE(std::equal(copy.begin(), copy.end(), moved.begin()));
+}
+
+// TEST LOOKUP
+
+TEST(frozen_set_lookup, case1) {
+  std::mt19937 gen(5);
+  std::uniform_int_distribution<int> dist(-5000, 5000);
+  s21::set<int> s;
+  std::set<int> ref;
+  for (int i = 0; i < 3000; ++i) {
+    int key = dist(gen);
+    s.insert(key);
+    ref.insert(key);
+  }
+  auto frozen = s.freeze();
+  for (int key = -5100; key <= 5100; ++key) {
+    EXPECT_EQ(frozen.contains(key), ref.count(key) == 1);
+    auto lo = frozen.lower_bound(key);
+    auto hi = frozen.upper_bound(key);
+    auto ref_lo = ref.lower_bound(key);
+    auto ref_hi = ref.upper_bound(key);
+    EXPECT_EQ(lo == frozen.end(), ref_lo == ref.end());
+    EXPECT_EQ(hi == frozen.end(), ref_hi == ref.end());
+    if (ref_lo != ref.end()) {
+      EXPECT_EQ(*lo, *ref_lo);
+    }
+    if (ref_hi != ref.end()) {
+      EXPECT_EQ(*hi, *ref_hi);
+    }
+  }
+}
+
+TEST(frozen_set_lookup, case2) {
+  s21::set<int, std::greater<int>> s{1, 5, 3, 9, 7};
+  auto frozen = s.freeze();
+  EXPECT_EQ(*frozen.begin(), 9);
+  EXPECT_EQ(*frozen.lower_bound(6), 5);
+  EXPECT_EQ(*frozen.upper_bound(5), 3);
+  EXPECT_TRUE(frozen.find(4) == frozen.end());
+  EXPECT_EQ(*frozen.find(7), 7);
+}
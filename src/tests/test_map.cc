@@ -2,6 +2,8 @@
 #include <gtest/gtest.h>
 
 #include <map>
+#include <string>
+#include <vector>
 
 #include "../s21_containers.h"
 
@@ -464,7 +466,7 @@ TEST(map_end, case1) {
 
   s21::map<int, double> s21_map = {pair1, pair2, pair3, pair4, pair5};
 
-  auto max_value = s21_map.end();
+  auto max_value = --s21_map.end();
 
   EXPECT_EQ(max_value->key_, 23);
 }
@@ -478,7 +480,7 @@ TEST(map_end, case2) {
 
   s21::map<double, std::string> s21_map = {pair1, pair2, pair3, pair4, pair5};
 
-  auto max_value = s21_map.end();
+  auto max_value = --s21_map.end();
 
   EXPECT_EQ(max_value->key_, 11.400000001);
 }
@@ -492,7 +494,7 @@ TEST(map_end, case3) {
 
   s21::map<std::string, int> s21_map = {pair1, pair2, pair3, pair4, pair5};
 
-  auto max_value = s21_map.end();
+  auto max_value = --s21_map.end();
 
   EXPECT_EQ(max_value->key_, "hola-hola");
 }
@@ -508,7 +510,7 @@ TEST(map_end, case5) {
 
   s21::map<double, std::string> s21_map = {pair1, pair1};
 
-  auto max_value = s21_map.end();
+  auto max_value = --s21_map.end();
 
   EXPECT_EQ(max_value->key_, 1.4);
   EXPECT_EQ(max_value->value_, "hello");
@@ -521,7 +523,7 @@ TEST(map_end, case6) {
 
   s21::map<std::string, int> s21_map = {pair1, pair2, pair3};
 
-  auto max_value = s21_map.end();
+  auto max_value = --s21_map.end();
 
   EXPECT_EQ(max_value->key_, "hello");
   EXPECT_EQ(max_value->value_, 1);
@@ -538,7 +540,7 @@ TEST(map_balance, case1) {
 
   s21::map<int, int> s21_map = {pair1, pair2, pair3, pair4, pair5};
 
-  EXPECT_EQ(s21_map.end()->key_, 1543);
+  EXPECT_EQ((--s21_map.end())->key_, 1543);
   EXPECT_EQ(s21_map.begin()->key_, 5);
   EXPECT_EQ(s21_map.size(), 5U);
 }
@@ -557,7 +559,7 @@ TEST(map_balance, case2) {
   s21::map<int, int> s21_map = {pair1, pair2, pair3, pair4, pair5,
                                 pair6, pair7, pair8, pair9};
 
-  EXPECT_EQ(s21_map.end()->key_, 60);
+  EXPECT_EQ((--s21_map.end())->key_, 60);
   EXPECT_EQ(s21_map.begin()->key_, 1);
   EXPECT_EQ(s21_map.size(), 9U);
 }
@@ -581,7 +583,7 @@ TEST(map_erase, case1) {
   ++it;
   s21_map.erase(it);
   EXPECT_EQ(s21_map.begin()->key_, 4);
-  EXPECT_EQ(s21_map.end()->key_, 18);
+  EXPECT_EQ((--s21_map.end())->key_, 18);
   EXPECT_EQ(s21_map.size(), 6U);
 }
 
@@ -603,19 +605,19 @@ TEST(map_erase, case3) {
   std::pair<std::string, int> pair4{"hola", 3};
   std::pair<std::string, int> pair5{"hello, there", 1};
   s21::map<std::string, int> s21_map = {pair1, pair2, pair3, pair4, pair5};
-  auto it = s21_map.end();
+  auto it = --s21_map.end();
   s21_map.erase(it);
-  EXPECT_EQ(s21_map.end()->key_, "hola");
+  EXPECT_EQ((--s21_map.end())->key_, "hola");
   EXPECT_EQ(s21_map.size(), 4U);
-  auto it2 = s21_map.end();
+  auto it2 = --s21_map.end();
   s21_map.erase(it2);
-  EXPECT_EQ(s21_map.end()->key_, "hi");
+  EXPECT_EQ((--s21_map.end())->key_, "hi");
   EXPECT_EQ(s21_map.size(), 3U);
   s21_map.insert(pair3);
   s21_map.insert(pair4);
-  auto it3 = s21_map.end();
+  auto it3 = --s21_map.end();
   s21_map.erase(it3);
-  EXPECT_EQ(s21_map.end()->key_, "hola");
+  EXPECT_EQ((--s21_map.end())->key_, "hola");
   EXPECT_EQ(s21_map.size(), 4U);
 }
 // // EMPTY TEST
@@ -897,3 +899,782 @@ TEST(map_merge, case3) {
 
   EXPECT_EQ(s21_map_int_res.size(), 6U);
 }
+
+TEST(map_merge, case4) {
+  s21::map<int, int> s21_map = {{1, 10}, {3, 30}};
+  s21::map<int, int> s21_other = {{2, 20}, {3, 300}};
+  const int *moved = &s21_other.at(2);
+
+  s21_map.merge(s21_other);
+  EXPECT_EQ(s21_map.size(), 3U);
+  EXPECT_EQ(&s21_map.at(2), moved);
+  EXPECT_EQ(s21_map.at(3), 30);
+  EXPECT_EQ(s21_other.size(), 1U);
+  EXPECT_EQ(s21_other.at(3), 300);
+}
+
+// // TEST TREE SIZE TRACKING
+
+TEST(map_tree, case1) {
+  s21::Tree<int, int> s21_tree;
+
+  EXPECT_TRUE(s21_tree.insert(10, 1));
+  EXPECT_TRUE(s21_tree.insert(5, 2));
+  EXPECT_FALSE(s21_tree.insert(10, 3));
+  EXPECT_EQ(s21_tree.size(), 2U);
+
+  EXPECT_FALSE(s21_tree.remove(42));
+  EXPECT_EQ(s21_tree.size(), 2U);
+  EXPECT_TRUE(s21_tree.remove(10));
+  EXPECT_TRUE(s21_tree.remove(5));
+  EXPECT_EQ(s21_tree.size(), 0U);
+  EXPECT_FALSE(s21_tree.remove(5));
+}
+
+TEST(map_tree, case2) {
+  s21::map<int, int> s21_map;
+  for (int i = 0; i < 1000; ++i) s21_map.insert(i, i);
+  EXPECT_EQ(s21_map.size(), 1000U);
+
+  for (int i = 0; i < 1000; i += 2) s21_map.erase(s21_map.find(i));
+  EXPECT_EQ(s21_map.size(), 500U);
+}
+
+// // TEST SINGLE DESCENT INSERT
+
+struct CountingKey {
+  static size_t comparisons;
+  int value;
+
+  bool operator<(const CountingKey &other) const {
+    ++comparisons;
+    return value < other.value;
+  }
+  bool operator>(const CountingKey &other) const {
+    ++comparisons;
+    return value > other.value;
+  }
+};
+
+size_t CountingKey::comparisons = 0;
+
+TEST(map_insert_unique, case1) {
+  s21::Tree<int, int> s21_tree;
+
+  auto res1 = s21_tree.insertUnique(7, 70);
+  EXPECT_TRUE(res1.second);
+  EXPECT_EQ(res1.first->key_, 7);
+
+  auto res2 = s21_tree.insertUnique(3, 30);
+  EXPECT_TRUE(res2.second);
+  EXPECT_EQ(res2.first->value_, 30);
+
+  auto res3 = s21_tree.insertUnique(7, 700);
+  EXPECT_FALSE(res3.second);
+  EXPECT_EQ(res3.first, res1.first);
+  EXPECT_EQ(res3.first->value_, 70);
+  EXPECT_EQ(s21_tree.size(), 2U);
+}
+
+TEST(map_insert_unique, case2) {
+  s21::map<CountingKey, int> s21_map;
+  for (int i = 0; i < 1023; ++i) s21_map.insert(CountingKey{i * 2}, i);
+
+  // A balanced tree of 1023 nodes is at most 15 levels deep and every level
+  // costs at most two comparisons, so one descent stays within 30.
+  CountingKey::comparisons = 0;
+  s21_map.insert(CountingKey{101}, 0);
+  EXPECT_LE(CountingKey::comparisons, 30U);
+
+  CountingKey::comparisons = 0;
+  s21_map.insert_or_assign(CountingKey{100}, 1);
+  EXPECT_LE(CountingKey::comparisons, 30U);
+
+  CountingKey::comparisons = 0;
+  s21_map[CountingKey{2045}] = 5;
+  EXPECT_LE(CountingKey::comparisons, 30U);
+  EXPECT_EQ(s21_map.size(), 1025U);
+}
+
+// // TEST TRANSPARENT LOOKUP
+
+TEST(map_transparent, case1) {
+  s21::map<std::string, int, std::less<>> s21_map = {
+      {"hello", 1}, {"hi", 2}, {"hola", 3}};
+  std::string buffer = "say hi to everyone";
+  std::string_view slice(buffer.data() + 4, 2);
+
+  EXPECT_TRUE(s21_map.contains(slice));
+  EXPECT_EQ(s21_map.find(slice)->value_, 2);
+  EXPECT_EQ(s21_map.at(slice), 2);
+  EXPECT_FALSE(s21_map.contains(std::string_view("hey")));
+  EXPECT_THROW(s21_map.at(std::string_view("hey")), std::out_of_range);
+
+  const char *key = "hola";
+  EXPECT_TRUE(s21_map.contains(key));
+  EXPECT_EQ(s21_map.at(key), 3);
+}
+
+TEST(map_transparent, case2) {
+  s21::map<std::string, int> s21_map = {{"hello", 1}, {"hi", 2}};
+
+  EXPECT_TRUE(s21_map.contains("hi"));
+  EXPECT_EQ(s21_map.at("hello"), 1);
+  EXPECT_THROW(s21_map.at("hola"), std::out_of_range);
+}
+
+// // TEST CUSTOM COMPARATOR
+
+TEST(map_compare, case1) {
+  s21::map<int, char, std::greater<int>> s21_map = {
+      {1, 'a'}, {3, 'c'}, {2, 'b'}};
+
+  EXPECT_EQ(s21_map.begin()->key_, 3);
+  EXPECT_EQ((--s21_map.end())->key_, 1);
+  EXPECT_EQ(s21_map.at(2), 'b');
+  EXPECT_TRUE(s21_map.key_comp()(3, 2));
+}
+
+TEST(map_compare, case2) {
+  using node_base = s21::Tree<int, int>::nodeBase;
+
+  EXPECT_EQ(sizeof(s21::Tree<int, int>), sizeof(node_base) + sizeof(size_t));
+  EXPECT_EQ(sizeof(s21::map<int, int, std::greater<int>>),
+            sizeof(node_base) + sizeof(size_t));
+}
+
+// // TEST AVL INVARIANTS
+
+template <typename Tree>
+size_t checkSubtree(const typename Tree::nodeBase *root,
+                    const typename Tree::nodeBase *parent, bool &valid) {
+  if (!root) return 0;
+  if (root->getParent() != parent) valid = false;
+  size_t hl = checkSubtree<Tree>(root->left, root, valid);
+  size_t hr = checkSubtree<Tree>(root->right, root, valid);
+  if (hl > hr + 1 || hr > hl + 1) valid = false;
+  if (root->getBalance() != static_cast<int>(hr) - static_cast<int>(hl))
+    valid = false;
+  size_t height = (hl > hr ? hl : hr) + 1;
+  if (root->left && !(Tree::keyOf(root->left) < Tree::keyOf(root)))
+    valid = false;
+  if (root->right && !(Tree::keyOf(root) < Tree::keyOf(root->right)))
+    valid = false;
+  return height;
+}
+
+TEST(map_avl, case1) {
+  s21::Tree<int, int> s21_tree;
+  std::map<int, int> std_map;
+  unsigned seed = 12345;
+  for (int i = 0; i < 20000; ++i) {
+    seed = seed * 1103515245U + 12345U;
+    int key = static_cast<int>((seed >> 8) % 2000);
+    if (seed & 1) {
+      EXPECT_EQ(s21_tree.insert(key, i), std_map.emplace(key, i).second);
+    } else {
+      EXPECT_EQ(s21_tree.remove(key), std_map.erase(key) == 1);
+    }
+    if (i % 1000 == 0) {
+      bool valid = true;
+      checkSubtree<s21::Tree<int, int>>(s21_tree.root(), &s21_tree.header_,
+                                        valid);
+      EXPECT_TRUE(valid);
+    }
+  }
+  bool valid = true;
+  checkSubtree<s21::Tree<int, int>>(s21_tree.root(), &s21_tree.header_,
+                                    valid);
+  EXPECT_TRUE(valid);
+  EXPECT_EQ(s21_tree.size(), std_map.size());
+  EXPECT_EQ(s21_tree.root()->countNodes(), std_map.size());
+}
+
+TEST(map_avl, case2) {
+  s21::map<int, int> s21_map;
+  for (int i = 0; i < 200000; ++i) s21_map.insert(i, i);
+  s21_map.clear();
+  EXPECT_EQ(s21_map.size(), 0U);
+}
+
+// // TEST ITERATION
+
+TEST(map_iterator, case1) {
+  s21::map<int, int> s21_map;
+  EXPECT_TRUE(s21_map.begin() == s21_map.end());
+
+  for (int i = 0; i < 100; ++i) s21_map.insert((i * 37) % 100, i);
+  int expected = 0;
+  for (auto it = s21_map.begin(); it != s21_map.end(); ++it)
+    EXPECT_EQ(it->key_, expected++);
+  EXPECT_EQ(expected, 100);
+
+  auto it = s21_map.end();
+  for (int i = 99; i >= 0; --i) EXPECT_EQ((--it)->key_, i);
+  EXPECT_TRUE(it == s21_map.begin());
+}
+
+TEST(map_iterator, case2) {
+  const s21::map<int, int> s21_map = {{3, 30}, {1, 10}, {2, 20}};
+
+  auto it = s21_map.begin();
+  EXPECT_EQ((it++)->value_, 10);
+  EXPECT_EQ(it->value_, 20);
+  EXPECT_TRUE(s21_map.find(4) == s21_map.end());
+  EXPECT_EQ((--s21_map.end())->key_, 3);
+}
+
+// // TEST POOL ALLOCATOR
+
+TEST(map_pool, case1) {
+  using pool = s21::pool_allocator<std::pair<const int, int>, 64>;
+  s21::Tree<int, int, std::less<int>, pool> s21_tree;
+
+  for (int i = 0; i < 1000; ++i) s21_tree.insert(i, i);
+  size_t chunks = s21_tree.nodeAllocator().chunks();
+  EXPECT_EQ(chunks, 16U);
+
+  for (int i = 0; i < 1000; i += 2) s21_tree.remove(i);
+  for (int i = 1000; i < 1500; ++i) s21_tree.insert(i, i);
+  EXPECT_EQ(s21_tree.nodeAllocator().chunks(), chunks);
+  EXPECT_EQ(s21_tree.size(), 1000U);
+
+  s21_tree.clear();
+  EXPECT_EQ(s21_tree.nodeAllocator().chunks(), 0U);
+  EXPECT_EQ(s21_tree.size(), 0U);
+  EXPECT_TRUE(s21_tree.insert(7, 7));
+}
+
+TEST(map_pool, case2) {
+  using pool = s21::pool_allocator<std::pair<const std::string, std::string>>;
+  s21::map<std::string, std::string, std::less<std::string>, pool> s21_map;
+  for (int i = 0; i < 100; ++i)
+    s21_map.insert(std::to_string(i), std::string(40, 'a' + i % 26));
+
+  auto s21_map_copy = s21_map;
+  s21_map.clear();
+  EXPECT_EQ(s21_map_copy.size(), 100U);
+  EXPECT_EQ(s21_map_copy.at("27"), std::string(40, 'b'));
+
+  s21::map<std::string, std::string, std::less<std::string>, pool>
+      s21_map_moved = std::move(s21_map_copy);
+  EXPECT_EQ(s21_map_moved.size(), 100U);
+  EXPECT_EQ(s21_map_moved.at("0"), std::string(40, 'a'));
+}
+
+TEST(map_pool, case3) {
+  using pool = s21::pool_allocator<std::pair<const int, int>, 64>;
+  using pool_tree = s21::Tree<int, int, std::less<int>, pool>;
+  pool alloc;
+  pool::rebind<pool_tree::node>::other rebound(alloc);
+  EXPECT_TRUE(rebound == alloc);
+  EXPECT_TRUE(pool(rebound) == alloc);
+  EXPECT_TRUE(rebound != pool());
+
+  pool_tree s21_tree(std::less<int>(), alloc);
+  EXPECT_TRUE(s21_tree.nodeAllocator() == alloc);
+  for (int i = 0; i < 100; ++i) s21_tree.insert(i, i);
+  EXPECT_EQ(rebound.chunks(), 2U);
+  s21_tree.clear();
+  for (int i = 0; i < 100; ++i) s21_tree.insert(i, i);
+  EXPECT_EQ(rebound.chunks(), 2U);
+  EXPECT_FALSE(pool_tree(s21_tree).nodeAllocator() == alloc);
+}
+
+TEST(map_avl, case3) {
+  using tree = s21::Tree<long long, long long>;
+
+  EXPECT_EQ(sizeof(tree::nodeBase), 3 * sizeof(void *));
+  EXPECT_EQ(sizeof(tree::node), 3 * sizeof(void *) + 2 * sizeof(long long));
+
+  tree s21_tree;
+  for (long long i = 0; i < 1000; ++i) s21_tree.insert(i, i);
+  for (auto it = s21_tree.begin(); it != s21_tree.end(); ++it)
+    EXPECT_GE(it->getBalance(), -1);
+  EXPECT_EQ(s21_tree.root()->getParent(), &s21_tree.header_);
+}
+
+// // TEST IN-PLACE CONSTRUCTION
+
+struct CopyCounter {
+  static size_t copies;
+  static size_t moves;
+  int value = 0;
+
+  CopyCounter() = default;
+  explicit CopyCounter(int v) : value(v) {}
+  CopyCounter(const CopyCounter &other) : value(other.value) { ++copies; }
+  CopyCounter(CopyCounter &&other) noexcept : value(other.value) { ++moves; }
+  CopyCounter &operator=(const CopyCounter &other) {
+    value = other.value;
+    ++copies;
+    return *this;
+  }
+  CopyCounter &operator=(CopyCounter &&other) noexcept {
+    value = other.value;
+    ++moves;
+    return *this;
+  }
+  bool operator<(const CopyCounter &other) const {
+    return value < other.value;
+  }
+
+  static void reset() { copies = moves = 0; }
+};
+
+size_t CopyCounter::copies = 0;
+size_t CopyCounter::moves = 0;
+
+TEST(map_emplace, case1) {
+  s21::map<CopyCounter, CopyCounter> s21_map;
+
+  CopyCounter::reset();
+  auto res1 = s21_map.emplace(1, 10);
+  EXPECT_TRUE(res1.second);
+  EXPECT_EQ(res1.first->value_.value, 10);
+  EXPECT_EQ(CopyCounter::copies + CopyCounter::moves, 0U);
+
+  CopyCounter::reset();
+  auto res2 = s21_map.try_emplace(CopyCounter(2), 20);
+  EXPECT_TRUE(res2.second);
+  EXPECT_EQ(CopyCounter::copies, 0U);
+  EXPECT_EQ(CopyCounter::moves, 1U);
+
+  CopyCounter::reset();
+  auto res3 = s21_map.try_emplace(CopyCounter(2), 200);
+  EXPECT_FALSE(res3.second);
+  EXPECT_EQ(res3.first->value_.value, 20);
+  EXPECT_EQ(CopyCounter::copies + CopyCounter::moves, 0U);
+
+  CopyCounter::reset();
+  s21_map.insert(CopyCounter(3), CopyCounter(30));
+  s21_map[CopyCounter(4)].value = 40;
+  EXPECT_EQ(CopyCounter::copies, 0U);
+  EXPECT_EQ(CopyCounter::moves, 3U);
+
+  auto res4 = s21_map.emplace(std::make_pair(CopyCounter(1), CopyCounter()));
+  EXPECT_FALSE(res4.second);
+  EXPECT_EQ(s21_map.size(), 4U);
+  EXPECT_EQ(s21_map.at(CopyCounter(4)).value, 40);
+}
+
+TEST(map_emplace, case2) {
+  s21::map<std::string, std::vector<int>> s21_map;
+  std::vector<int> big(1000, 7);
+  const int *data = big.data();
+
+  s21_map.insert_or_assign("a", std::move(big));
+  EXPECT_EQ(s21_map.at("a").data(), data);
+
+  auto res = s21_map.try_emplace("b", 3, 5);
+  EXPECT_TRUE(res.second);
+  EXPECT_EQ(res.first->value_, std::vector<int>({5, 5, 5}));
+
+  std::pair<const std::string, std::vector<int>> value("c", {1, 2});
+  data = value.second.data();
+  s21_map.insert(std::move(value));
+  EXPECT_EQ(s21_map.at("c").data(), data);
+  EXPECT_EQ(s21_map.size(), 3U);
+}
+
+// // TEST SORTED BULK BUILD
+
+TEST(map_sorted, case1) {
+  std::vector<std::pair<const CountingKey, int>> items;
+  for (int i = 0; i < 1000; ++i) {
+    items.emplace_back(CountingKey{i}, i);
+    if (i % 10 == 0) items.emplace_back(CountingKey{i}, -1);
+  }
+
+  CountingKey::comparisons = 0;
+  auto s21_map = s21::map<CountingKey, int>::from_sorted(items.begin(),
+                                                         items.end());
+  // Two comparisons per element at most: one for order, one for equality.
+  EXPECT_LE(CountingKey::comparisons, 2 * items.size());
+  EXPECT_EQ(s21_map.size(), 1000U);
+  EXPECT_EQ(s21_map.at(CountingKey{0}), 0);
+  EXPECT_EQ(s21_map.at(CountingKey{990}), 990);
+
+  using tree = s21::map<CountingKey, int>::tree;
+  tree s21_tree;
+  s21_tree.insertSorted(items.begin(), items.end());
+  bool valid = true;
+  EXPECT_EQ(checkSubtree<tree>(s21_tree.root(), &s21_tree.header_, valid),
+            10U);
+  EXPECT_TRUE(valid);
+}
+
+TEST(map_sorted, case2) {
+  s21::map<int, int> s21_map = {{1, 1}, {5, 5}, {3, 3}, {3, 30}, {7, 7}};
+  std::map<int, int> std_map = {{1, 1}, {5, 5}, {3, 3}, {3, 30}, {7, 7}};
+  std::vector<std::pair<const int, int>> more = {{0, 0}, {5, 50}, {9, 9}};
+  s21_map.insert_sorted(more.begin(), more.end());
+  std_map.insert(more.begin(), more.end());
+
+  EXPECT_EQ(s21_map.size(), std_map.size());
+  auto it = s21_map.begin();
+  for (auto &item : std_map) {
+    EXPECT_EQ(it->key_, item.first);
+    EXPECT_EQ(it->value_, item.second);
+    ++it;
+  }
+
+  s21::map<int, int> s21_empty = s21::map<int, int>::from_sorted(
+      more.begin(), more.begin());
+  EXPECT_TRUE(s21_empty.empty());
+  EXPECT_EQ(s21_empty.begin(), s21_empty.end());
+}
+
+// // TEST COPY
+
+template <typename Tree>
+bool sameShape(const typename Tree::nodeBase *lhs,
+               const typename Tree::nodeBase *rhs) {
+  if (!lhs || !rhs) return lhs == rhs;
+  return lhs != rhs && Tree::keyOf(lhs) == Tree::keyOf(rhs) &&
+         lhs->getBalance() == rhs->getBalance() &&
+         sameShape<Tree>(lhs->left, rhs->left) &&
+         sameShape<Tree>(lhs->right, rhs->right);
+}
+
+TEST(map_copy, case1) {
+  using tree = s21::Tree<int, int>;
+  tree empty;
+  tree empty_copy(empty);
+  EXPECT_EQ(empty_copy.size(), 0U);
+  EXPECT_EQ(empty_copy.root(), nullptr);
+  EXPECT_EQ(empty_copy.begin(), empty_copy.end());
+
+  tree s21_tree;
+  for (int i = 0; i < 5000; ++i) s21_tree.insert((i * 7919) % 5000, i);
+  tree s21_copy(s21_tree);
+  EXPECT_EQ(s21_copy.size(), s21_tree.size());
+  EXPECT_TRUE(sameShape<tree>(s21_copy.root(), s21_tree.root()));
+  bool valid = true;
+  checkSubtree<tree>(s21_copy.root(), &s21_copy.header_, valid);
+  EXPECT_TRUE(valid);
+
+  s21_copy = empty;
+  EXPECT_EQ(s21_copy.size(), 0U);
+  EXPECT_EQ(s21_copy.begin(), s21_copy.end());
+}
+
+struct ThrowingCopy {
+  static int live;
+  static int copies_left;
+
+  ThrowingCopy() { ++live; }
+  ThrowingCopy(const ThrowingCopy &) {
+    if (copies_left-- == 0) throw std::runtime_error("copy failed");
+    ++live;
+  }
+  ~ThrowingCopy() { --live; }
+};
+
+int ThrowingCopy::live = 0;
+int ThrowingCopy::copies_left = 0;
+
+TEST(map_copy, case2) {
+  s21::map<int, ThrowingCopy> s21_map;
+  for (int i = 0; i < 100; ++i) s21_map[i];
+  EXPECT_EQ(ThrowingCopy::live, 100);
+
+  ThrowingCopy::copies_left = 60;
+  using throwing_map = s21::map<int, ThrowingCopy>;
+  EXPECT_THROW(throwing_map s21_copy(s21_map), std::runtime_error);
+  EXPECT_EQ(ThrowingCopy::live, 100);
+
+  ThrowingCopy::copies_left = 100;
+  s21::map<int, ThrowingCopy> s21_copy(s21_map);
+  EXPECT_EQ(ThrowingCopy::live, 200);
+}
+
+// // TEST ORDER STATISTICS
+
+template <typename Tree>
+size_t checkSizes(const typename Tree::nodeBase *root, bool &valid) {
+  if (!root) return 0;
+  size_t size = 1 + checkSizes<Tree>(root->left, valid) +
+                checkSizes<Tree>(root->right, valid);
+  if (Tree::augment_base::sizeOf(root) != size) valid = false;
+  return size;
+}
+
+TEST(map_rank, case1) {
+  using tree = s21::Tree<int, int, std::less<int>,
+                         std::allocator<std::pair<const int, int>>, true>;
+  tree s21_tree;
+  std::map<int, int> std_map;
+  unsigned seed = 777;
+  for (int i = 0; i < 20000; ++i) {
+    seed = seed * 1103515245U + 12345U;
+    int key = static_cast<int>((seed >> 8) % 3000);
+    if (seed & 1) {
+      s21_tree.insert(key, i);
+      std_map.emplace(key, i);
+    } else {
+      s21_tree.remove(key);
+      std_map.erase(key);
+    }
+    if (i % 2000 == 0) {
+      bool valid = true;
+      checkSubtree<tree>(s21_tree.root(), &s21_tree.header_, valid);
+      checkSizes<tree>(s21_tree.root(), valid);
+      EXPECT_TRUE(valid);
+    }
+  }
+  size_t k = 0;
+  for (auto &item : std_map) {
+    EXPECT_EQ(s21_tree.selectNode(k)->key_, item.first);
+    EXPECT_EQ(s21_tree.rank(item.first), k);
+    ++k;
+  }
+  EXPECT_EQ(s21_tree.selectNode(k), nullptr);
+
+  tree s21_copy(s21_tree);
+  bool valid = true;
+  checkSizes<tree>(s21_copy.root(), valid);
+  EXPECT_TRUE(valid);
+}
+
+TEST(map_rank, case2) {
+  std::vector<std::pair<const int, int>> items;
+  for (int i = 0; i < 100; ++i) items.emplace_back(i * 10, i);
+  auto s21_map =
+      s21::ranked_map<int, int>::from_sorted(items.begin(), items.end());
+
+  EXPECT_EQ(s21_map.nth_element(0)->key_, 0);
+  EXPECT_EQ(s21_map.nth_element(42)->value_, 42);
+  EXPECT_EQ(s21_map.nth_element(100), s21_map.end());
+  EXPECT_EQ(s21_map.rank(55), 6U);
+  EXPECT_EQ(s21_map.rank(-1), 0U);
+  EXPECT_EQ(s21_map.rank(5000), 100U);
+  EXPECT_EQ(s21_map.count_range(100, 200), 10U);
+  EXPECT_EQ(s21_map.count_range(200, 100), 0U);
+
+  s21_map.erase(s21_map.nth_element(0));
+  s21_map.insert(5, 0);
+  EXPECT_EQ(s21_map.nth_element(0)->key_, 5);
+  EXPECT_EQ(s21_map.count_range(0, 11), 2U);
+  EXPECT_EQ(sizeof(s21::ranked_map<int, int>::tree::node),
+            sizeof(s21::map<int, int>::tree::node) + sizeof(size_t));
+}
+
+// // TEST BOUNDS
+
+TEST(map_bounds, case1) {
+  s21::map<int, int> s21_map;
+  std::map<int, int> std_map;
+  for (int i = 0; i < 200; i += 3) {
+    s21_map.insert(i, i);
+    std_map.emplace(i, i);
+  }
+  for (int key = -2; key < 205; ++key) {
+    auto lower = s21_map.lower_bound(key);
+    auto upper = s21_map.upper_bound(key);
+    auto range = s21_map.equal_range(key);
+    auto std_lower = std_map.lower_bound(key);
+    auto std_upper = std_map.upper_bound(key);
+    EXPECT_EQ(lower == s21_map.end(), std_lower == std_map.end());
+    EXPECT_EQ(upper == s21_map.end(), std_upper == std_map.end());
+    if (std_lower != std_map.end()) {
+      EXPECT_EQ(lower->key_, std_lower->first);
+    }
+    if (std_upper != std_map.end()) {
+      EXPECT_EQ(upper->key_, std_upper->first);
+    }
+    EXPECT_EQ(range.first, lower);
+    EXPECT_EQ(range.second, upper);
+  }
+
+  s21::map<int, int> s21_empty;
+  EXPECT_EQ(s21_empty.lower_bound(1), s21_empty.end());
+  EXPECT_EQ(s21_empty.equal_range(1).second, s21_empty.end());
+}
+
+TEST(map_bounds, case2) {
+  const s21::map<std::string, int, std::less<>> s21_map = {
+      {"apple", 1}, {"banana", 2}, {"cherry", 3}, {"date", 4}};
+  std::string_view from = "b";
+  std::string_view to = "d";
+
+  int sum = 0;
+  for (auto it = s21_map.lower_bound(from), et = s21_map.lower_bound(to);
+       it != et; ++it)
+    sum += it->value_;
+  EXPECT_EQ(sum, 5);
+
+  auto range = s21_map.equal_range("cherry");
+  EXPECT_EQ(range.first->value_, 3);
+  EXPECT_EQ(range.second->value_, 4);
+  EXPECT_EQ(s21_map.upper_bound("date"), s21_map.end());
+}
+
+// // TEST SPLIT AND JOIN
+
+TEST(map_split, case1) {
+  using tree = s21::Tree<int, int>;
+  for (int n : {0, 1, 2, 7, 100, 1000}) {
+    for (int at : {-1, 0, 1, n / 3, n / 2, n - 1, n, n + 5}) {
+      tree s21_tree;
+      for (int i = 0; i < n; ++i) s21_tree.insert((i * 37) % n, i);
+      tree upper = s21_tree.split(at);
+
+      bool valid = true;
+      checkSubtree<tree>(s21_tree.root(), &s21_tree.header_, valid);
+      checkSubtree<tree>(upper.root(), &upper.header_, valid);
+      EXPECT_TRUE(valid);
+      int expected_lower = at < 0 ? 0 : (at > n ? n : at);
+      EXPECT_EQ(s21_tree.size(), static_cast<size_t>(expected_lower));
+      EXPECT_EQ(upper.size(), static_cast<size_t>(n - expected_lower));
+      if (upper.size()) {
+        EXPECT_EQ(upper.begin()->key_, expected_lower);
+      }
+
+      s21_tree.join(upper);
+      checkSubtree<tree>(s21_tree.root(), &s21_tree.header_, valid);
+      EXPECT_TRUE(valid);
+      EXPECT_EQ(s21_tree.size(), static_cast<size_t>(n));
+      EXPECT_EQ(upper.size(), 0U);
+      int key = 0;
+      for (auto it = s21_tree.begin(); it != s21_tree.end(); ++it)
+        EXPECT_EQ(it->key_, key++);
+    }
+  }
+}
+
+TEST(map_split, case2) {
+  using tree = s21::Tree<int, int>;
+  tree small;
+  tree big;
+  for (int i = 0; i < 3; ++i) small.insert(i, i);
+  for (int i = 10; i < 5000; ++i) big.insert(i, i);
+  small.join(big);
+  bool valid = true;
+  checkSubtree<tree>(small.root(), &small.header_, valid);
+  EXPECT_TRUE(valid);
+  EXPECT_EQ(small.size(), 4993U);
+
+  tree overlapping;
+  overlapping.insert(4000, 0);
+  EXPECT_THROW(small.join(overlapping), std::invalid_argument);
+  EXPECT_EQ(overlapping.size(), 1U);
+
+  using pool_tree =
+      s21::Tree<int, int, std::less<int>,
+                s21::pool_allocator<std::pair<const int, int>>, true>;
+  pool_tree pooled;
+  for (int i = 0; i < 300; ++i) pooled.insert(i, i);
+  pool_tree upper = pooled.split(100);
+  EXPECT_EQ(pooled.size(), 100U);
+  EXPECT_EQ(upper.size(), 200U);
+  EXPECT_EQ(upper.rank(150), 50U);
+  checkSizes<pool_tree>(upper.root(), valid);
+  checkSizes<pool_tree>(pooled.root(), valid);
+  EXPECT_TRUE(valid);
+}
+
+TEST(map_erase_range, case1) {
+  s21::ranked_map<int, int> s21_map;
+  std::map<int, int> std_map;
+  for (int i = 0; i < 2000; ++i) {
+    s21_map.insert(i * 2, i);
+    std_map.emplace(i * 2, i);
+  }
+  EXPECT_EQ(s21_map.erase_range(100, 301), 101U);
+  std_map.erase(std_map.lower_bound(100), std_map.lower_bound(301));
+  EXPECT_EQ(s21_map.erase_range(3000, 10000), 500U);
+  std_map.erase(std_map.lower_bound(3000), std_map.end());
+  EXPECT_EQ(s21_map.erase_range(-5, 0), 0U);
+  EXPECT_EQ(s21_map.erase_range(50, 50), 0U);
+
+  auto it = s21_map.erase(s21_map.begin(), s21_map.find(10));
+  std_map.erase(std_map.begin(), std_map.find(10));
+  EXPECT_EQ(it->key_, 10);
+
+  EXPECT_EQ(s21_map.size(), std_map.size());
+  size_t k = 0;
+  for (auto &item : std_map) {
+    EXPECT_EQ(s21_map.nth_element(k)->key_, item.first);
+    EXPECT_EQ(s21_map.rank(item.first), k++);
+  }
+
+  s21_map.erase(s21_map.begin(), s21_map.end());
+  EXPECT_TRUE(s21_map.empty());
+}
+
+// // TEST NODE HANDLES
+
+TEST(map_extract, case1) {
+  s21::map<int, std::string> shard1 = {{1, "one"}, {2, "two"}, {3, "three"}};
+  s21::map<int, std::string> shard2 = {{3, "drei"}};
+  const std::string *address = &shard1.at(2);
+
+  auto handle = shard1.extract(2);
+  EXPECT_FALSE(handle.empty());
+  EXPECT_EQ(handle.key(), 2);
+  EXPECT_EQ(handle.mapped(), "two");
+  EXPECT_EQ(shard1.size(), 2U);
+  EXPECT_FALSE(shard1.contains(2));
+
+  auto res1 = shard2.insert(std::move(handle));
+  EXPECT_TRUE(res1.inserted);
+  EXPECT_TRUE(res1.node.empty());
+  EXPECT_EQ(res1.position->key_, 2);
+  EXPECT_EQ(&shard2.at(2), address);
+
+  auto res2 = shard2.insert(shard1.extract(shard1.find(3)));
+  EXPECT_FALSE(res2.inserted);
+  EXPECT_EQ(res2.position->value_, "drei");
+  EXPECT_EQ(res2.node.mapped(), "three");
+  EXPECT_EQ(shard1.size(), 1U);
+
+  EXPECT_TRUE(shard1.extract(42).empty());
+  EXPECT_TRUE(shard1.extract(shard1.end()).empty());
+  auto res3 = shard2.insert(s21::map<int, std::string>::node_type());
+  EXPECT_FALSE(res3.inserted);
+  EXPECT_EQ(res3.position, shard2.end());
+}
+
+TEST(map_extract, case2) {
+  using pool_map =
+      s21::ranked_map<int, int, std::less<int>,
+                      s21::pool_allocator<std::pair<const int, int>>>;
+  pool_map shard1 = {{1, 1}, {2, 2}, {3, 3}};
+  pool_map shard2 = {{4, 4}};
+
+  auto res = shard2.insert(shard1.extract(1));
+  EXPECT_TRUE(res.inserted);
+  EXPECT_TRUE(res.node.empty());
+  EXPECT_EQ(shard2.nth_element(0)->key_, 1);
+  EXPECT_EQ(shard2.rank(4), 1U);
+  EXPECT_EQ(shard1.rank(3), 1U);
+  shard1.clear();
+  EXPECT_EQ(shard2.at(1), 1);
+}
+
+TEST(map_extract, case3) {
+  using pool_map = s21::map<int, int, std::less<int>,
+                            s21::pool_allocator<std::pair<const int, int>>>;
+  pool_map s21_map;
+  for (int i = 0; i < 100; ++i) s21_map.insert(i, i);
+
+  const int *before = &s21_map.find(42)->value_;
+  auto res = s21_map.insert(s21_map.extract(42));
+  EXPECT_TRUE(res.inserted);
+  EXPECT_EQ(&res.position->value_, before);
+
+  auto kept = s21_map.extract(7);
+  s21_map.clear();
+  EXPECT_EQ(kept.key(), 7);
+  EXPECT_EQ(kept.mapped(), 7);
+  s21_map.insert(std::move(kept));
+  EXPECT_EQ(s21_map.at(7), 7);
+
+  pool_map::node_type orphan;
+  {
+    pool_map local = {{1, 10}};
+    orphan = local.extract(1);
+  }
+  EXPECT_EQ(orphan.mapped(), 10);
+}
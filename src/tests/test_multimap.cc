@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../s21_containers.h"
+
+template <typename Map, typename Ref>
+void sameEntries(const Map &m, const Ref &ref) {
+  ASSERT_EQ(m.size(), ref.size());
+  auto it = m.begin();
+  for (const auto &item : ref) {
+    EXPECT_EQ(it->key_, item.first);
+    EXPECT_EQ(it->value_, item.second);
+    ++it;
+  }
+  EXPECT_TRUE(it == m.end());
+}
+
+TEST(multimap_constructor, case1) {
+  s21::multimap<std::string, int> m{{"b", 1}, {"a", 2}, {"b", 3}};
+  std::multimap<std::string, int> ref{{"b", 1}, {"a", 2}, {"b", 3}};
+  sameEntries(m, ref);
+  s21::multimap<std::string, int> copy(m);
+  s21::multimap<std::string, int> moved(std::move(m));
+  EXPECT_TRUE(m.empty());
+  sameEntries(moved, ref);
+  moved.clear();
+  EXPECT_TRUE(moved.empty());
+  sameEntries(copy, ref);
+  m = copy;
+  EXPECT_EQ(m.count("b"), 2U);
+}
+
+TEST(multimap_insert, case1) {
+  std::mt19937 gen(53);
+  std::uniform_int_distribution<int> dist(0, 200);
+  s21::multimap<int, int> m;
+  std::multimap<int, int> ref;
+  for (int round = 0; round < 4; ++round) {
+    for (int i = 0; i < 2000; ++i) {
+      int key = dist(gen);
+      auto it = m.insert(key, i);
+      ref.insert({key, i});
+      EXPECT_EQ(it->value_, i);
+      EXPECT_TRUE(++it == m.upper_bound(key));
+    }
+    sameEntries(m, ref);
+    for (int i = 0; i < 200; ++i) {
+      int key = dist(gen);
+      EXPECT_EQ(m.erase(key), ref.erase(key));
+    }
+    sameEntries(m, ref);
+    for (int i = 0; i < 500; ++i) {
+      int key = dist(gen);
+      auto it = m.find(key);
+      auto ref_it = ref.find(key);
+      ASSERT_EQ(it == m.end(), ref_it == ref.end());
+      if (it != m.end()) {
+        EXPECT_EQ(it->value_, ref_it->second);
+        m.erase(it);
+        ref.erase(ref_it);
+      }
+    }
+    sameEntries(m, ref);
+  }
+}
+
+TEST(multimap_lookup, case1) {
+  s21::multimap<int, std::string> m;
+  m.insert(2, "x");
+  m.emplace(std::make_pair(1, std::string("a")));
+  m.insert(2, "y");
+  m.insert(3, "z");
+  m.insert(2, "w");
+  EXPECT_EQ(m.count(2), 3U);
+  EXPECT_EQ(m.count(5), 0U);
+  auto range = m.equal_range(2);
+  std::vector<std::string> values;
+  for (; range.first != range.second; ++range.first) {
+    values.push_back(range.first->value_);
+  }
+  std::vector<std::string> expected_values{"x", "y", "w"};
+  EXPECT_EQ(values, expected_values);
+  EXPECT_EQ(m.find(2)->value_, "x");
+  EXPECT_TRUE(m.find(4) == m.end());
+  EXPECT_TRUE(m.contains(3));
+  const s21::multimap<int, std::string> &view = m;
+  EXPECT_EQ(view.lower_bound(2)->value_, "x");
+  EXPECT_EQ(view.upper_bound(2)->value_, "z");
+}
+
+TEST(multimap_merge, case1) {
+  s21::multimap<int, int> a{{1, 1}, {2, 2}};
+  s21::multimap<int, int> b{{2, 3}, {3, 4}};
+  a.merge(b);
+  sameEntries(a, std::multimap<int, int>{{1, 1}, {2, 2}, {2, 3}, {3, 4}});
+  EXPECT_TRUE(b.empty());
+  a.swap(b);
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(b.size(), 4U);
+}
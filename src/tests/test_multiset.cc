@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "../s21_containers.h"
+
+template <typename Set, typename Ref>
+void sameKeys(const Set &s, const Ref &ref) {
+  ASSERT_EQ(s.size(), ref.size());
+  EXPECT_TRUE(std::equal(ref.begin(), ref.end(), s.begin()));
+  std::vector<typename Ref::value_type> backwards;
+  for (auto it = s.end(); it != s.begin();) backwards.push_back(*--it);
+  EXPECT_TRUE(std::equal(ref.rbegin(), ref.rend(), backwards.begin()));
+}
+
+TEST(multiset_constructor, case1) {
+  s21::multiset<std::string> s{"b", "a", "b", "c", "b"};
+  sameKeys(s, std::multiset<std::string>{"a", "b", "b", "b", "c"});
+  EXPECT_EQ(s.unique_size(), 3U);
+  s21::multiset<std::string> copy(s);
+  s21::multiset<std::string> moved(std::move(s));
+  EXPECT_TRUE(s.empty());
+  EXPECT_EQ(moved.size(), 5U);
+  moved.clear();
+  EXPECT_TRUE(moved.empty());
+  EXPECT_TRUE(moved.begin() == moved.end());
+  EXPECT_EQ(copy.count("b"), 3U);
+  s = copy;
+  EXPECT_EQ(s.size(), 5U);
+}
+
+TEST(multiset_insert, case1) {
+  std::mt19937 gen(47);
+  std::uniform_int_distribution<int> dist(0, 300);
+  s21::multiset<int> s;
+  std::multiset<int> ref;
+  for (int round = 0; round < 4; ++round) {
+    for (int i = 0; i < 2000; ++i) {
+      int key = dist(gen);
+      auto it = s.insert(key);
+      ref.insert(key);
+      EXPECT_EQ(*it, key);
+      EXPECT_TRUE(++it == s.upper_bound(key));
+    }
+    sameKeys(s, ref);
+    for (int i = 0; i < 1500; ++i) {
+      int key = dist(gen);
+      auto it = s.find(key);
+      auto ref_it = ref.find(key);
+      ASSERT_EQ(it == s.end(), ref_it == ref.end());
+      if (it != s.end()) {
+        s.erase(it);
+        ref.erase(ref_it);
+      }
+    }
+    sameKeys(s, ref);
+    for (int key = 0; key <= 300; ++key) {
+      EXPECT_EQ(s.count(key), ref.count(key));
+    }
+  }
+}
+
+TEST(multiset_lookup, case1) {
+  s21::multiset<int> s{5, 1, 5, 9, 5, 1};
+  auto range = s.equal_range(5);
+  EXPECT_EQ(std::distance(range.first, range.second), 3);
+  EXPECT_TRUE(range.first == s.lower_bound(5));
+  EXPECT_TRUE(range.second == s.upper_bound(5));
+  EXPECT_EQ(*range.second, 9);
+  EXPECT_TRUE(s.lower_bound(10) == s.end());
+  EXPECT_TRUE(s.find(4) == s.end());
+  EXPECT_EQ(s.count(4), 0U);
+  EXPECT_TRUE(s.contains(9));
+  EXPECT_EQ(s.erase(5), 3U);
+  EXPECT_EQ(s.erase(5), 0U);
+  sameKeys(s, std::multiset<int>{1, 1, 9});
+}
+
+TEST(multiset_merge, case1) {
+  s21::multiset<int> a{1, 2, 2};
+  s21::multiset<int> b{2, 3, 3};
+  a.merge(b);
+  sameKeys(a, std::multiset<int>{1, 2, 2, 2, 3, 3});
+  EXPECT_TRUE(b.empty());
+  a.swap(b);
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(b.size(), 6U);
+}
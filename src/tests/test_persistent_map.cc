@@ -0,0 +1,172 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_containers.h"
+
+template <typename Map, typename Ref>
+void sameContents(const Map &m, const Ref &ref) {
+  ASSERT_EQ(m.size(), ref.size());
+  auto it = m.begin();
+  for (const auto &item : ref) {
+    EXPECT_EQ(it->key_, item.first);
+    EXPECT_EQ(it->value_, item.second);
+    ++it;
+  }
+  EXPECT_TRUE(it == m.end());
+}
+
+// Counts how many values a write had to copy.
+struct CountedValue {
+  static int copies;
+  int value = 0;
+
+  CountedValue() = default;
+  explicit CountedValue(int v) : value(v) {}
+  CountedValue(const CountedValue &other) : value(other.value) { ++copies; }
+  CountedValue &operator=(const CountedValue &other) = default;
+};
+int CountedValue::copies = 0;
+
+// Throws on the copy after the next copies_left ones and counts live
+// instances, so a leaked node shows up as a nonzero count.
+struct ThrowingValue {
+  static int copies_left;
+  static int live;
+  int value = 0;
+
+  explicit ThrowingValue(int v) : value(v) { ++live; }
+  ThrowingValue(const ThrowingValue &other) : value(other.value) {
+    if (copies_left == 0) throw std::runtime_error("copy");
+    if (copies_left > 0) --copies_left;
+    ++live;
+  }
+  ThrowingValue &operator=(const ThrowingValue &other) = default;
+  ~ThrowingValue() { --live; }
+};
+int ThrowingValue::copies_left = -1;
+int ThrowingValue::live = 0;
+
+// TEST CONSTRUCTORS
+
+TEST(persistent_map_constructor, case1) {
+  s21::persistent_map<int, std::string> m{{2, "b"}, {1, "a"}, {2, "x"}};
+  sameContents(m, std::map<int, std::string>{{1, "a"}, {2, "b"}});
+  EXPECT_EQ(m.at(2), "b");
+  EXPECT_THROW(m.at(3), std::out_of_range);
+  s21::persistent_map<int, std::string> moved(std::move(m));
+  EXPECT_TRUE(m.empty());
+  EXPECT_EQ(moved.size(), 2U);
+  m = moved;
+  EXPECT_TRUE(m.shares_root(moved));
+}
+
+// TEST SNAPSHOTS
+
+TEST(persistent_map_snapshot, case1) {
+  std::mt19937 gen(31);
+  std::uniform_int_distribution<int> dist(0, 500);
+  s21::persistent_map<int, int> m;
+  std::map<int, int> ref;
+  std::vector<s21::persistent_map<int, int>> versions;
+  std::vector<std::map<int, int>> ref_versions;
+  for (int i = 0; i < 3000; ++i) {
+    int key = dist(gen);
+    if (i % 3 == 2) {
+      EXPECT_EQ(m.erase(key), ref.erase(key));
+    } else if (i % 3 == 1) {
+      EXPECT_EQ(m.insert_or_assign(key, i).second,
+                ref.insert_or_assign(key, i).second);
+    } else {
+      EXPECT_EQ(m.insert(key, i).second, ref.insert({key, i}).second);
+    }
+    if (i % 100 == 0) {
+      versions.push_back(m.snapshot());
+      ref_versions.push_back(ref);
+    }
+  }
+  sameContents(m, ref);
+  for (size_t i = 0; i < versions.size(); ++i) {
+    sameContents(versions[i], ref_versions[i]);
+  }
+}
+
+TEST(persistent_map_snapshot, case2) {
+  s21::persistent_map<int, CountedValue> m;
+  for (int i = 0; i < 1024; ++i) m.insert(i, CountedValue(i));
+  auto snap = m.snapshot();
+  EXPECT_TRUE(snap.shares_root(m));
+
+  CountedValue::copies = 0;
+  m.insert_or_assign(500, CountedValue(-1));
+  EXPECT_LE(CountedValue::copies, 3 * 11);
+  EXPECT_EQ(snap.at(500).value, 500);
+  EXPECT_EQ(m.at(500).value, -1);
+
+  CountedValue::copies = 0;
+  m.insert(500, CountedValue(7));
+  m.erase(5000);
+  EXPECT_EQ(CountedValue::copies, 0);
+  EXPECT_EQ(m.size(), 1024U);
+}
+
+TEST(persistent_map_snapshot, case3) {
+  s21::persistent_map<int, int> m;
+  for (int i = 0; i < 10000; ++i) m.insert(i, i);
+  auto snap = m.snapshot();
+  std::thread reader([snap] {
+    long long sum = 0;
+    for (int round = 0; round < 5; ++round) {
+      for (auto it = snap.begin(); it != snap.end(); ++it) sum += it->value_;
+    }
+    EXPECT_EQ(sum, 5LL * 9999 * 10000 / 2);
+  });
+  for (int i = 0; i < 10000; i += 2) m.erase(i);
+  reader.join();
+  EXPECT_EQ(m.size(), 5000U);
+  EXPECT_EQ(snap.size(), 10000U);
+  EXPECT_FALSE(m.contains(0));
+  EXPECT_TRUE(snap.contains(0));
+  EXPECT_EQ(m.find(1)->value_, 1);
+  EXPECT_TRUE(m.find(0) == m.end());
+}
+
+// TEST EXCEPTION SAFETY
+
+TEST(persistent_map_exceptions, case1) {
+  {
+    s21::persistent_map<int, ThrowingValue> m;
+    for (int i = 0; i < 128; i += 2) m.insert(i, ThrowingValue(i));
+    auto before = m.snapshot();
+    int failures = 0;
+    for (int budget = 0; budget < 24; ++budget) {
+      for (int op = 0; op < 3; ++op) {
+        ThrowingValue obj(-1);
+        ThrowingValue::copies_left = budget;
+        bool threw = false;
+        try {
+          if (op == 0) m.insert(budget * 5 + 1, obj);
+          if (op == 1) m.insert_or_assign(budget * 4, obj);
+          if (op == 2) m.erase(budget * 2 + 40);
+        } catch (const std::runtime_error &) {
+          threw = true;
+        }
+        ThrowingValue::copies_left = -1;
+        if (threw) {
+          ++failures;
+          EXPECT_TRUE(m.shares_root(before));
+        }
+        m = before;
+      }
+    }
+    EXPECT_GT(failures, 10);
+    EXPECT_EQ(m.size(), 64U);
+  }
+  EXPECT_EQ(ThrowingValue::live, 0);
+}
+
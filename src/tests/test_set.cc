@@ -1,7 +1,10 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <iterator>
 #include <set>
+#include <vector>
 
 #include "../s21_containers.h"
 
@@ -243,20 +246,20 @@ TEST(set_begin, case5) {
 TEST(set_end, case1) {
   s21::set<int> s21_set = {9, 15, 7, 23, 2};
 
-  EXPECT_EQ(*s21_set.end(), 23);
+  EXPECT_EQ(*--s21_set.end(), 23);
 }
 
 TEST(set_end, case2) {
   s21::set<double> s21_set = {11.4, 2.770001, 3.901, 11.400000001, 3.9};
 
-  EXPECT_EQ(*s21_set.end(), 11.400000001);
+  EXPECT_EQ(*--s21_set.end(), 11.400000001);
 }
 
 TEST(set_end, case3) {
   s21::set<std::string> s21_set = {"hello", "hi", "hola-hola", "hola",
                                    "hello, there"};
 
-  EXPECT_EQ(*s21_set.end(), "hola-hola");
+  EXPECT_EQ(*--s21_set.end(), "hola-hola");
 }
 
 // TEST(set_end, case4) {
@@ -268,7 +271,7 @@ TEST(set_end, case3) {
 TEST(set_end, case5) {
   s21::set<double> s21_set = {1.4, 1.4};
 
-  EXPECT_EQ(*s21_set.end(), 1.4);
+  EXPECT_EQ(*--s21_set.end(), 1.4);
 }
 
 // // TEST BALANCE
@@ -276,14 +279,14 @@ TEST(set_end, case5) {
 TEST(set_balance, case1) {
   s21::set<int> s21_set = {1, 15, 5};
 
-  EXPECT_EQ(*s21_set.end(), 15);
+  EXPECT_EQ(*--s21_set.end(), 15);
   EXPECT_EQ(s21_set.size(), 3U);
 }
 
 TEST(set_balance, case2) {
   s21::set<double> s21_set = {11.4, 2.770001, 3.901};
 
-  EXPECT_EQ(*s21_set.end(), 11.4);
+  EXPECT_EQ(*--s21_set.end(), 11.4);
   EXPECT_EQ(s21_set.size(), 3U);
 }
 
@@ -291,14 +294,14 @@ TEST(set_balance, case3) {
   s21::set<std::string> s21_set = {"hello", "hi", "hola-hola", "hola",
                                    "hello, there"};
 
-  EXPECT_EQ(*s21_set.end(), "hola-hola");
+  EXPECT_EQ(*--s21_set.end(), "hola-hola");
   EXPECT_EQ(s21_set.size(), 5U);
 }
 
 TEST(set_balance, case4) {
   s21::set<int> s21_set = {10, 5, 20, 30, 1543};
 
-  EXPECT_EQ(*s21_set.end(), 1543);
+  EXPECT_EQ(*--s21_set.end(), 1543);
   EXPECT_EQ(*s21_set.begin(), 5);
   EXPECT_EQ(s21_set.size(), 5U);
 }
@@ -306,7 +309,7 @@ TEST(set_balance, case4) {
 TEST(set_balance, case5) {
   s21::set<int> s21_set = {30, 5, 43, 1, 20, 40, 60, 35, 32};
 
-  EXPECT_EQ(*s21_set.end(), 60);
+  EXPECT_EQ(*--s21_set.end(), 60);
   EXPECT_EQ(*s21_set.begin(), 1);
   EXPECT_EQ(s21_set.size(), 9U);
 }
@@ -323,26 +326,26 @@ TEST(set_erase, case1) {
   ++it;
   s21_set.erase(it);
   EXPECT_EQ(*s21_set.begin(), 4);
-  EXPECT_EQ(*s21_set.end(), 18);
+  EXPECT_EQ(*--s21_set.end(), 18);
   EXPECT_EQ(s21_set.size(), 6U);
 
   it = s21_set.begin();
   s21_set.erase(it);
   EXPECT_EQ(*s21_set.begin(), 5);
-  EXPECT_EQ(*s21_set.end(), 18);
+  EXPECT_EQ(*--s21_set.end(), 18);
   EXPECT_EQ(s21_set.size(), 5U);
 
   it = s21_set.begin();
   ++it;
   s21_set.erase(it);
   EXPECT_EQ(*s21_set.begin(), 5);
-  EXPECT_EQ(*s21_set.end(), 18);
+  EXPECT_EQ(*--s21_set.end(), 18);
   EXPECT_EQ(s21_set.size(), 4U);
 
-  it = s21_set.end();
+  it = --s21_set.end();
   s21_set.erase(it);
   EXPECT_EQ(*s21_set.begin(), 5);
-  EXPECT_EQ(*s21_set.end(), 16);
+  EXPECT_EQ(*--s21_set.end(), 16);
   EXPECT_EQ(s21_set.size(), 3U);
 
   it = s21_set.begin();
@@ -431,7 +434,11 @@ TEST(set_MaxSize, case1) {
   s21::set<double> s21_set;
   std::set<double> std_set;
 
-  EXPECT_EQ(s21_set.max_size(), std_set.max_size());
+  // Set nodes store the key once, so they are smaller than std::set nodes.
+  EXPECT_GE(s21_set.max_size(), std_set.max_size());
+  EXPECT_EQ(s21_set.max_size(),
+            static_cast<size_t>(std::numeric_limits<std::ptrdiff_t>::max()) /
+                sizeof(s21::set<double>::tree::node));
 }
 
 TEST(set_MaxSize, case2) {
@@ -439,7 +446,7 @@ TEST(set_MaxSize, case2) {
 
   std::set<double> std_set = {22.2, 44.48, 12.4457, 1.44};
 
-  EXPECT_EQ(s21_set.max_size(), std_set.max_size());
+  EXPECT_GE(s21_set.max_size(), std_set.max_size());
 }
 
 // // TEST SWAP
@@ -519,3 +526,276 @@ TEST(set_find, case2) {
   ++it;
   EXPECT_EQ(*s21_set.find(22.2), *it);
 }
+
+// TEST TRANSPARENT LOOKUP
+
+TEST(set_transparent, case1) {
+  s21::set<std::string, std::less<>> s21_set = {"hello", "hi", "hola"};
+  std::string buffer = "hello, world";
+  std::string_view slice(buffer.data(), 5);
+
+  EXPECT_TRUE(s21_set.contains(slice));
+  EXPECT_EQ(*s21_set.find(slice), "hello");
+  EXPECT_TRUE(s21_set.contains("hola"));
+  EXPECT_FALSE(s21_set.contains(std::string_view("world")));
+}
+
+// TEST CUSTOM COMPARATOR
+
+struct ModuloCompare {
+  int mod;
+  bool operator()(int a, int b) const { return a % mod < b % mod; }
+};
+
+TEST(set_compare, case1) {
+  s21::set<int, ModuloCompare> s21_set({3, 13, 7, 25}, ModuloCompare{10});
+
+  EXPECT_EQ(s21_set.size(), 3U);
+  EXPECT_EQ(*s21_set.begin(), 3);
+  EXPECT_EQ(*--s21_set.end(), 7);
+  EXPECT_TRUE(s21_set.contains(17));
+  EXPECT_FALSE(s21_set.contains(14));
+  EXPECT_EQ(s21_set.key_comp().mod, 10);
+}
+
+TEST(set_compare, case2) {
+  s21::set<int, ModuloCompare> s21_set_ref(ModuloCompare{4});
+  s21_set_ref.insert(1);
+  s21_set_ref.insert(5);
+  s21::set<int, ModuloCompare> s21_set_res(s21_set_ref);
+
+  EXPECT_EQ(s21_set_res.size(), 1U);
+  EXPECT_EQ(s21_set_res.key_comp().mod, 4);
+}
+
+// TEST ITERATION
+
+TEST(set_iterator, case1) {
+  s21::set<int> s21_set = {5, 1, 4, 2, 3};
+
+  int expected = 1;
+  for (auto it = s21_set.begin(); it != s21_set.end(); ++it)
+    EXPECT_EQ(*it, expected++);
+  EXPECT_EQ(expected, 6);
+  EXPECT_TRUE(s21_set.find(42) == s21_set.end());
+
+  s21::set<int> s21_set_empty;
+  EXPECT_TRUE(s21_set_empty.begin() == s21_set_empty.end());
+  EXPECT_TRUE(s21_set_empty.find(42) == s21_set_empty.end());
+}
+
+// TEST POOL ALLOCATOR
+
+TEST(set_pool, case1) {
+  s21::set<int, std::less<int>, s21::pool_allocator<int>> s21_set;
+  for (int i = 0; i < 5000; ++i) s21_set.insert(i % 1000);
+  EXPECT_EQ(s21_set.size(), 1000U);
+
+  auto it = s21_set.begin();
+  for (int i = 0; i < 500; ++i) ++it;
+  EXPECT_EQ(*it, 500);
+
+  s21::set<int, std::less<int>, s21::pool_allocator<int>> s21_set_copy(
+      s21_set);
+  s21_set.clear();
+  EXPECT_TRUE(s21_set.empty());
+  EXPECT_EQ(s21_set_copy.size(), 1000U);
+  EXPECT_TRUE(s21_set_copy.contains(999));
+}
+
+// TEST KEY-ONLY NODES
+
+TEST(set_layout, case1) {
+  using node = s21::set<std::string>::tree::node;
+
+  EXPECT_EQ(sizeof(node), 3 * sizeof(void *) + sizeof(std::string));
+  EXPECT_EQ(sizeof(s21::set<long long>::tree::node), 4 * sizeof(void *));
+
+  s21::Tree<int, void> s21_tree(5);
+  EXPECT_TRUE(s21_tree.insert(3));
+  EXPECT_FALSE(s21_tree.insert(5));
+  EXPECT_EQ(*s21_tree.kbegin(), 3);
+}
+
+// TEST IN-PLACE CONSTRUCTION
+
+TEST(set_emplace, case1) {
+  s21::set<std::string> s21_set;
+  std::string long_key(100, 'x');
+  const char *data = long_key.data();
+
+  auto res1 = s21_set.insert(std::move(long_key));
+  EXPECT_TRUE(res1.second);
+  EXPECT_EQ((*res1.first).data(), data);
+
+  auto res2 = s21_set.emplace(3, 'a');
+  EXPECT_TRUE(res2.second);
+  EXPECT_EQ(*res2.first, "aaa");
+
+  auto res3 = s21_set.emplace("aaa");
+  EXPECT_FALSE(res3.second);
+  EXPECT_EQ(res3.first, res2.first);
+  EXPECT_EQ(s21_set.size(), 2U);
+}
+
+// TEST SORTED BULK BUILD
+
+TEST(set_sorted, case1) {
+  std::vector<int> items;
+  for (int i = 0; i < 100000; ++i) items.push_back(i / 2);
+
+  auto s21_set = s21::set<int>::from_sorted(items.begin(), items.end());
+  EXPECT_EQ(s21_set.size(), 50000U);
+  int expected = 0;
+  for (auto it = s21_set.begin(); it != s21_set.end(); ++it)
+    EXPECT_EQ(*it, expected++);
+
+  s21::set<int, std::greater<int>> s21_desc = {9, 7, 8, 1, 1};
+  std::set<int, std::greater<int>> std_desc = {9, 7, 8, 1, 1};
+  EXPECT_EQ(s21_desc.size(), std_desc.size());
+  auto it = s21_desc.begin();
+  for (int value : std_desc) EXPECT_EQ(*it++, value);
+}
+
+// TEST ORDER STATISTICS
+
+TEST(set_rank, case1) {
+  s21::ranked_set<int> s21_set = {50, 10, 40, 20, 30};
+
+  EXPECT_EQ(*s21_set.nth_element(2), 30);
+  EXPECT_EQ(s21_set.rank(35), 3U);
+  EXPECT_EQ(s21_set.count_range(10, 40), 3U);
+
+  s21_set.erase(s21_set.find(30));
+  EXPECT_EQ(*s21_set.nth_element(2), 40);
+  EXPECT_EQ(s21_set.nth_element(4), s21_set.end());
+}
+
+// TEST BOUNDS
+
+TEST(set_bounds, case1) {
+  s21::set<int, std::greater<int>> s21_set = {10, 20, 30, 40};
+  std::set<int, std::greater<int>> std_set = {10, 20, 30, 40};
+
+  for (int key = 5; key <= 45; key += 5) {
+    auto lower = s21_set.lower_bound(key);
+    auto std_lower = std_set.lower_bound(key);
+    auto upper = s21_set.upper_bound(key);
+    auto std_upper = std_set.upper_bound(key);
+    if (std_lower == std_set.end()) {
+      EXPECT_EQ(lower, s21_set.end());
+    } else {
+      EXPECT_EQ(*lower, *std_lower);
+    }
+    if (std_upper == std_set.end()) {
+      EXPECT_EQ(upper, s21_set.end());
+    } else {
+      EXPECT_EQ(*upper, *std_upper);
+    }
+  }
+  auto range = s21_set.equal_range(30);
+  EXPECT_EQ(*range.first, 30);
+  EXPECT_EQ(*range.second, 20);
+}
+
+// TEST RANGE ERASE
+
+TEST(set_erase_range, case1) {
+  s21::set<int> s21_set = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  EXPECT_EQ(s21_set.erase_range(3, 7), 4U);
+  EXPECT_EQ(s21_set.size(), 5U);
+  EXPECT_FALSE(s21_set.contains(3));
+  EXPECT_TRUE(s21_set.contains(7));
+  auto it = s21_set.erase(s21_set.find(8), s21_set.end());
+  EXPECT_EQ(it, s21_set.end());
+  EXPECT_EQ(*--s21_set.end(), 7);
+}
+
+// TEST MERGE AND SET ALGEBRA
+
+TEST(set_merge, case1) {
+  s21::set<std::string> s21_set = {"a", "c", "e"};
+  s21::set<std::string> s21_other = {"b", "c", "d"};
+  const std::string *moved = &*s21_other.find("b");
+
+  s21_set.merge(s21_other);
+  EXPECT_EQ(s21_set.size(), 5U);
+  EXPECT_EQ(s21_other.size(), 1U);
+  EXPECT_EQ(*s21_other.begin(), "c");
+  // Nodes are relinked, not copied.
+  EXPECT_EQ(&*s21_set.find("b"), moved);
+
+  std::string expected = "abcde";
+  auto it = s21_set.begin();
+  for (char c : expected) EXPECT_EQ(*it++, std::string(1, c));
+  s21_set.merge(s21_set);
+  EXPECT_EQ(s21_set.size(), 5U);
+}
+
+TEST(set_merge, case2) {
+  using pool_set = s21::set<int, std::less<int>, s21::pool_allocator<int>>;
+  pool_set s21_set = {1, 3, 5};
+  pool_set s21_other = {2, 3, 4};
+
+  s21_set.merge(s21_other);
+  EXPECT_EQ(s21_set.size(), 5U);
+  EXPECT_EQ(s21_other.size(), 1U);
+  s21_other.clear();
+  EXPECT_TRUE(s21_set.contains(4));
+}
+
+TEST(set_algebra, case1) {
+  s21::set<int> lhs;
+  s21::set<int> rhs;
+  std::set<int> std_lhs;
+  std::set<int> std_rhs;
+  for (int i = 0; i < 300; i += 2) {
+    lhs.insert(i);
+    std_lhs.insert(i);
+  }
+  for (int i = 0; i < 300; i += 3) {
+    rhs.insert(i);
+    std_rhs.insert(i);
+  }
+
+  std::vector<int> expected;
+  std::set_union(std_lhs.begin(), std_lhs.end(), std_rhs.begin(),
+                 std_rhs.end(), std::back_inserter(expected));
+  s21::set<int> result = lhs.set_union(rhs);
+  EXPECT_EQ(std::vector<int>(result.begin(), result.end()), expected);
+
+  expected.clear();
+  std::set_intersection(std_lhs.begin(), std_lhs.end(), std_rhs.begin(),
+                        std_rhs.end(), std::back_inserter(expected));
+  result = lhs.set_intersection(rhs);
+  EXPECT_EQ(std::vector<int>(result.begin(), result.end()), expected);
+
+  expected.clear();
+  std::set_difference(std_lhs.begin(), std_lhs.end(), std_rhs.begin(),
+                      std_rhs.end(), std::back_inserter(expected));
+  result = lhs.set_difference(rhs);
+  EXPECT_EQ(std::vector<int>(result.begin(), result.end()), expected);
+  EXPECT_EQ(result.size(), expected.size());
+
+  EXPECT_TRUE(lhs.set_intersection(s21::set<int>()).empty());
+  EXPECT_EQ(s21::set<int>().set_union(rhs).size(), rhs.size());
+}
+
+// TEST NODE HANDLES
+
+TEST(set_extract, case1) {
+  s21::set<std::string> s21_set = {"alpha", "beta"};
+  s21::set<std::string> s21_other;
+  const std::string *address = &*s21_set.find("beta");
+
+  auto res = s21_other.insert(s21_set.extract("beta"));
+  EXPECT_TRUE(res.inserted);
+  EXPECT_EQ(&*res.position, address);
+  EXPECT_EQ(s21_set.size(), 1U);
+  EXPECT_EQ(s21_other.size(), 1U);
+
+  auto handle = s21_set.extract(s21_set.begin());
+  EXPECT_EQ(handle.key(), "alpha");
+  EXPECT_TRUE(s21_set.empty());
+}
@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_containers.h"
+
+// TEST SINGLE THREAD
+
+TEST(sharded_map_basic, case1) {
+  s21::sharded_map<std::string, int, 4> m;
+  EXPECT_TRUE(m.empty());
+  EXPECT_TRUE(m.insert("a", 1));
+  EXPECT_FALSE(m.insert("a", 2));
+  EXPECT_FALSE(m.insert_or_assign("a", 3));
+  EXPECT_TRUE(m.insert("b", 4));
+  m.update("c", [](int &value) { value += 5; });
+  m.update("c", [](int &value) { value += 5; });
+  EXPECT_EQ(m.size(), 3U);
+  EXPECT_EQ(*m.find("a"), 3);
+  EXPECT_EQ(*m.find("c"), 10);
+  EXPECT_FALSE(m.find("d").has_value());
+  EXPECT_EQ(m.erase("b"), 1U);
+  EXPECT_EQ(m.erase("b"), 0U);
+  EXPECT_FALSE(m.contains("b"));
+  m.clear();
+  EXPECT_TRUE(m.empty());
+}
+
+TEST(sharded_map_basic, case2) {
+  s21::sharded_map<int, int, 7> m;
+  std::map<int, int> ref;
+  for (int i = 0; i < 1000; ++i) {
+    int key = (i * 7919) % 1543;
+    m.insert_or_assign(key, i);
+    ref[key] = i;
+  }
+  std::vector<std::pair<int, int>> ordered;
+  m.for_each_ordered([&](const int &key, const int &value) {
+    ordered.emplace_back(key, value);
+  });
+  std::vector<std::pair<int, int>> expected_order(ref.begin(), ref.end());
+  EXPECT_EQ(ordered, expected_order);
+
+  std::atomic<long long> sum{0};
+  m.for_each([&](const int &key, int &value) { sum += key + value; }, 3);
+  long long expected = 0;
+  for (const auto &item : ref) expected += item.first + item.second;
+  EXPECT_EQ(sum.load(), expected);
+}
+
+TEST(sharded_map_basic, case3) {
+  s21::sharded_map<size_t, int> m;
+  for (size_t i = 0; i < 1600; ++i) m.insert(i * 16, 0);
+  for (size_t i = 0; i < 16; ++i) {
+    EXPECT_GT(m.shard_size(i), 50U);
+    EXPECT_LT(m.shard_size(i), 150U);
+  }
+}
+
+TEST(sharded_map_basic, case4) {
+  s21::sharded_map<int, int> m;
+  for (int i = 0; i < 1000; ++i) m.insert(i, i);
+  for (size_t threads = 1; threads <= 16; threads *= 4) {
+    std::atomic<int> visited{0};
+    EXPECT_THROW(m.for_each(
+                     [&](const int &key, int &) {
+                       ++visited;
+                       if (key % 100 == 7) throw std::runtime_error("fn");
+                     },
+                     threads),
+                 std::runtime_error);
+    EXPECT_GT(visited.load(), 0);
+  }
+  EXPECT_EQ(m.size(), 1000U);
+}
+
+TEST(sharded_map_basic, case5) {
+  using greater_map =
+      s21::sharded_map<int, int, 5, std::hash<int>, std::greater<int>>;
+  greater_map m;
+  int calls = 0;
+  m.for_each_ordered([&](const int &, const int &) { ++calls; });
+  EXPECT_EQ(calls, 0);
+  m.insert(42, 0);
+  std::vector<int> keys;
+  m.for_each_ordered([&](const int &key, const int &) { keys.push_back(key); });
+  EXPECT_EQ(keys, std::vector<int>{42});
+  for (int i = 0; i < 300; ++i) m.insert(i * 13 % 301, i);
+  keys.clear();
+  m.for_each_ordered([&](const int &key, const int &) { keys.push_back(key); });
+  EXPECT_EQ(keys.size(), m.size());
+  EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end(), std::greater<int>()));
+}
+
+// TEST THREADS
+
+TEST(sharded_map_threads, case1) {
+  s21::sharded_map<int, int> m;
+  std::vector<std::thread> writers;
+  for (int t = 0; t < 4; ++t) {
+    writers.emplace_back([&m, t] {
+      for (int i = 0; i < 2000; ++i) {
+        m.insert(t * 2000 + i, i);
+        m.update(i % 10, [](int &value) { ++value; });
+      }
+    });
+  }
+  for (std::thread &t : writers) t.join();
+  EXPECT_EQ(m.size(), 8000U);
+  int counted = 0;
+  for (int i = 0; i < 10; ++i) counted += *m.find(i) - i;
+  EXPECT_EQ(counted, 4 * 2000);
+}
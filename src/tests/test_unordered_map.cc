@@ -0,0 +1,215 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <new>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+#include "../s21_containers.h"
+
+template <typename Map, typename Ref>
+void sameEntries(const Map &m, const Ref &ref) {
+  ASSERT_EQ(m.size(), ref.size());
+  typename Ref::size_type visited = 0;
+  for (auto it = m.begin(); it != m.end(); ++it, ++visited) {
+    auto found = ref.find(it->key_);
+    ASSERT_TRUE(found != ref.end());
+    EXPECT_EQ(it->value_, found->second);
+  }
+  EXPECT_EQ(visited, ref.size());
+  for (const auto &item : ref) EXPECT_EQ(m.at(item.first), item.second);
+}
+
+// Sends every key to the same home slot.
+struct constantHash {
+  size_t operator()(int) const { return 7; }
+};
+
+// Allocator whose copies share a budget: with the budget at n >= 0 the
+// allocation after the next n ones throws std::bad_alloc.
+template <typename T>
+struct failingAllocator {
+  using value_type = T;
+
+  failingAllocator() = default;
+  explicit failingAllocator(int *budget) : budget_(budget) {}
+  template <typename U>
+  failingAllocator(const failingAllocator<U> &other)
+      : budget_(other.budget_) {}
+
+  T *allocate(size_t n) {
+    if (budget_ && *budget_ == 0) {
+      *budget_ = -1;
+      throw std::bad_alloc();
+    }
+    if (budget_ && *budget_ > 0) --*budget_;
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T *ptr, size_t n) { std::allocator<T>().deallocate(ptr, n); }
+
+  template <typename U>
+  bool operator==(const failingAllocator<U> &other) const {
+    return budget_ == other.budget_;
+  }
+  template <typename U>
+  bool operator!=(const failingAllocator<U> &other) const {
+    return budget_ != other.budget_;
+  }
+
+  int *budget_ = nullptr;
+};
+
+TEST(unordered_map_constructor, case1) {
+  s21::unordered_map<std::string, int> m{{"one", 1}, {"two", 2}, {"one", 3}};
+  EXPECT_EQ(m.size(), 2U);
+  EXPECT_EQ(m.at("one"), 1);
+  s21::unordered_map<std::string, int> copy(m);
+  s21::unordered_map<std::string, int> moved(std::move(m));
+  EXPECT_TRUE(m.empty());
+  EXPECT_EQ(moved.at("two"), 2);
+  copy = moved;
+  moved.clear();
+  EXPECT_TRUE(moved.empty());
+  EXPECT_TRUE(moved.begin() == moved.end());
+  EXPECT_EQ(copy.size(), 2U);
+  EXPECT_EQ(copy.at("two"), 2);
+}
+
+TEST(unordered_map_insert, case1) {
+  std::mt19937 gen(41);
+  std::uniform_int_distribution<int> dist(-5000, 5000);
+  s21::unordered_map<int, int> m;
+  std::unordered_map<int, int> ref;
+  for (int round = 0; round < 4; ++round) {
+    for (int i = 0; i < 6000; ++i) {
+      int key = dist(gen);
+      auto res = m.insert(key, i);
+      EXPECT_EQ(res.second, ref.insert({key, i}).second);
+      EXPECT_EQ(res.first->key_, key);
+      EXPECT_EQ(res.first->value_, ref[key]);
+    }
+    sameEntries(m, ref);
+    for (int i = 0; i < 6000; ++i) {
+      int key = dist(gen);
+      EXPECT_EQ(m.erase(key), ref.erase(key));
+    }
+    sameEntries(m, ref);
+    EXPECT_LE(m.load_factor(), m.max_load_factor());
+  }
+}
+
+TEST(unordered_map_insert, case2) {
+  s21::unordered_map<std::string, std::string> m;
+  for (int i = 0; i < 1000; ++i) {
+    m.insert_or_assign(std::to_string(i), std::string(i % 40, 'x'));
+  }
+  for (int i = 0; i < 1000; i += 2) {
+    auto res = m.insert_or_assign(std::to_string(i), "even");
+    EXPECT_FALSE(res.second);
+  }
+  EXPECT_EQ(m.size(), 1000U);
+  EXPECT_EQ(m.at("10"), "even");
+  EXPECT_EQ(m.at("11"), std::string(11, 'x'));
+  EXPECT_FALSE(m.try_emplace("11", 3, 'y').second);
+  EXPECT_TRUE(m.try_emplace("1000", 3, 'y').second);
+  EXPECT_EQ(m["1000"], "yyy");
+  EXPECT_EQ(m["1001"], "");
+  EXPECT_EQ(m.size(), 1002U);
+}
+
+TEST(unordered_map_lookup, case1) {
+  s21::unordered_map<int, int> m;
+  EXPECT_TRUE(m.find(1) == m.end());
+  EXPECT_FALSE(m.contains(1));
+  EXPECT_THROW(m.at(1), std::out_of_range);
+  for (int i = 0; i < 100; ++i) m[i * 1024] = i;
+  const s21::unordered_map<int, int> &view = m;
+  EXPECT_EQ(view.find(5 * 1024)->value_, 5);
+  EXPECT_TRUE(view.find(5) == view.end());
+  m.find(7 * 1024)->value_ = -7;
+  EXPECT_EQ(view.at(7 * 1024), -7);
+  m.erase(m.find(7 * 1024));
+  EXPECT_FALSE(m.contains(7 * 1024));
+  EXPECT_THROW(view.at(7 * 1024), std::out_of_range);
+  EXPECT_EQ(m.size(), 99U);
+}
+
+TEST(unordered_map_hash_policy, case1) {
+  s21::unordered_map<int, int> m;
+  EXPECT_EQ(m.bucket_count(), 0U);
+  EXPECT_EQ(m.load_factor(), 0.0f);
+  m.reserve(1000);
+  size_t buckets = m.bucket_count();
+  EXPECT_GE(buckets * m.max_load_factor(), 1000.0f);
+  for (int i = 0; i < 1000; ++i) m.insert(i, i);
+  EXPECT_EQ(m.bucket_count(), buckets);
+  m.insert(1000, 1000);
+  m.insert(1001, 1001);
+  EXPECT_GE(m.bucket_count(), buckets);
+}
+
+// A rehash that cannot allocate leaves the table as it was.
+TEST(unordered_map_hash_policy, case2) {
+  using failing_map =
+      s21::unordered_map<int, int, std::hash<int>, std::equal_to<int>,
+                         failingAllocator<std::pair<const int, int>>>;
+  for (int failing = 0; failing < 2; ++failing) {
+    int budget = -1;
+    failing_map m{std::hash<int>(), std::equal_to<int>(),
+                  failingAllocator<std::pair<const int, int>>(&budget)};
+    std::unordered_map<int, int> ref;
+    int next = 0;
+    for (; next < 20 || (m.size() + 1) * 8 <= m.bucket_count() * 7; ++next) {
+      m.insert(next, next);
+      ref.emplace(next, next);
+    }
+    size_t buckets = m.bucket_count();
+    budget = failing;
+    EXPECT_THROW(m.insert(next, next), std::bad_alloc);
+    EXPECT_EQ(budget, -1);
+    EXPECT_EQ(m.bucket_count(), buckets);
+    sameEntries(m, ref);
+    m.insert(next, next);
+    ref.emplace(next, next);
+    EXPECT_GT(m.bucket_count(), buckets);
+    sameEntries(m, ref);
+  }
+}
+
+TEST(unordered_map_collisions, case1) {
+  s21::unordered_map<int, int, constantHash> m;
+  for (int i = 0; i < 200; ++i) m.insert(i, -i);
+  for (int i = 0; i < 200; i += 3) m.erase(i);
+  for (int i = 0; i < 200; ++i) {
+    EXPECT_EQ(m.contains(i), i % 3 != 0);
+  }
+  EXPECT_EQ(m.at(200 - 1), -(200 - 1));
+  int inserted = 0;
+  EXPECT_THROW(
+      {
+        for (int i = 1000;; ++i) {
+          m.insert(i, i);
+          ++inserted;
+        }
+      },
+      std::length_error);
+  EXPECT_EQ(m.size(), 133U + inserted);
+  EXPECT_TRUE(m.contains(1000));
+  EXPECT_EQ(m.at(1000 + inserted - 1), 1000 + inserted - 1);
+}
+
+TEST(unordered_map_merge, case1) {
+  s21::unordered_map<int, std::string> a{{1, "a"}, {2, "b"}};
+  s21::unordered_map<int, std::string> b{{2, "x"}, {3, "c"}, {4, "d"}};
+  a.merge(b);
+  EXPECT_EQ(a.size(), 4U);
+  EXPECT_EQ(a.at(2), "b");
+  EXPECT_EQ(a.at(3), "c");
+  EXPECT_EQ(b.size(), 1U);
+  EXPECT_EQ(b.at(2), "x");
+  a.swap(b);
+  EXPECT_EQ(a.size(), 1U);
+  EXPECT_EQ(b.size(), 4U);
+}
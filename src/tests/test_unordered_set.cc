@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <unordered_set>
+
+#include "../s21_containers.h"
+
+template <typename Set, typename Ref>
+void sameKeys(const Set &s, const Ref &ref) {
+  ASSERT_EQ(s.size(), ref.size());
+  typename Ref::size_type visited = 0;
+  for (auto it = s.begin(); it != s.end(); ++it, ++visited) {
+    EXPECT_EQ(ref.count(*it), 1U);
+  }
+  EXPECT_EQ(visited, ref.size());
+}
+
+TEST(unordered_set_constructor, case1) {
+  s21::unordered_set<std::string> s{"world", "hello", "!", "hello"};
+  sameKeys(s, std::unordered_set<std::string>{"world", "hello", "!"});
+  s21::unordered_set<std::string> copy(s);
+  s.clear();
+  EXPECT_TRUE(s.empty());
+  EXPECT_EQ(copy.size(), 3U);
+  EXPECT_TRUE(copy.contains("!"));
+  s = std::move(copy);
+  EXPECT_EQ(s.size(), 3U);
+}
+
+TEST(unordered_set_insert, case1) {
+  std::mt19937 gen(43);
+  std::uniform_int_distribution<long> dist(-3000, 3000);
+  s21::unordered_set<long> s;
+  std::unordered_set<long> ref;
+  for (int round = 0; round < 4; ++round) {
+    for (int i = 0; i < 4000; ++i) {
+      long key = dist(gen) * (1L << 20);
+      auto res = s.insert(key);
+      EXPECT_EQ(res.second, ref.insert(key).second);
+      EXPECT_EQ(*res.first, key);
+    }
+    sameKeys(s, ref);
+    for (int i = 0; i < 4000; ++i) {
+      long key = dist(gen) * (1L << 20);
+      EXPECT_EQ(s.erase(key), ref.erase(key));
+    }
+    sameKeys(s, ref);
+    s21::unordered_set<long> copy(s);
+    sameKeys(copy, ref);
+  }
+}
+
+TEST(unordered_set_lookup, case1) {
+  s21::unordered_set<int> s;
+  for (int i = 0; i < 100; i += 5) s.insert(i);
+  EXPECT_TRUE(s.find(12) == s.end());
+  EXPECT_EQ(*s.find(95), 95);
+  s.erase(s.find(95));
+  EXPECT_FALSE(s.contains(95));
+  EXPECT_EQ(s.erase(95), 0U);
+  EXPECT_EQ(s.size(), 19U);
+}
+
+TEST(unordered_set_merge, case1) {
+  s21::unordered_set<int> a{1, 2, 3};
+  s21::unordered_set<int> b{3, 4};
+  a.merge(b);
+  sameKeys(a, std::unordered_set<int>{1, 2, 3, 4});
+  sameKeys(b, std::unordered_set<int>{3});
+  a.swap(b);
+  EXPECT_EQ(a.size(), 1U);
+  EXPECT_EQ(b.size(), 4U);
+}